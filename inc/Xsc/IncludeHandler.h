@@ -23,6 +23,7 @@ namespace Xsc
 /**
 \brief Interface for handling new include streams.
 \remarks The default implementation will read the files from an std::ifstream.
+With the pipelined frontend (see Options::pipelinedFrontend), the 'Include' function is called on the worker thread of the pre-processor.
 */
 class XSC_EXPORT IncludeHandler
 {
@@ -36,12 +37,41 @@ class XSC_EXPORT IncludeHandler
         \param[in] includeName Specifies the include filename.
         \param[in] useSearchPathsFirst Specifies whether to first use the search paths to find the file.
         \return Unique pointer to the new input stream.
+        \remarks Implementations can report the path of the file they have actually opened with 'ReportIncludedPath'.
         */
         virtual std::unique_ptr<std::istream> Include(const std::string& filename, bool useSearchPathsFirst);
+
+        /**
+        \brief Returns the path of the file that is opened by the default implementation of the 'Include' function.
+        \param[in] includeName Specifies the include filename.
+        \param[in] useSearchPathsFirst Specifies whether to first use the search paths to find the file.
+        \return Path of the file (e.g. with its search path prepended), or an empty string if the file was not found.
+        */
+        virtual std::string ResolvePath(const std::string& filename, bool useSearchPathsFirst);
+
+        /**
+        \brief Returns the path that has been reported by the last call to 'Include' and resets it.
+        \return Path of the last included file, or an empty string if the last call to 'Include' did not report its path.
+        \remarks This is used to list all included files (see Reflection::ReflectionData::includedFiles).
+        If no path has been reported, the include filename is listed as it is.
+        */
+        std::string FetchIncludedPath();
         
         //! List of search paths.
         std::vector<std::string> searchPaths;
 
+    protected:
+
+        /**
+        \brief Reports the path of the file that has actually been opened by the current call to 'Include' (e.g. with its search path prepended).
+        \see FetchIncludedPath
+        */
+        void ReportIncludedPath(const std::string& path);
+
+    private:
+
+        std::string includedPath_;
+
 };
 
 
@@ -119,6 +119,41 @@ struct BindingSlot
     int         location;
 };
 
+//! Member variable of a buffer block with its memory layout.
+struct BufferField
+{
+    //! Identifier of the member variable.
+    std::string     ident;
+
+    //! Type name of the member variable (e.g. "float4x4" or "float3[4]").
+    std::string     type;
+
+    //! Offset (in bytes) from the start of the buffer block.
+    unsigned int    offset          = 0;
+
+    //! Size (in bytes) of the member variable.
+    unsigned int    size            = 0;
+
+    //! Stride (in bytes) between two array elements, or 0 if the member is not an array.
+    unsigned int    arrayStride     = 0;
+
+    //! Stride (in bytes) between two matrix columns (or rows for row-major matrices), or 0 if the member is not a matrix.
+    unsigned int    matrixStride    = 0;
+};
+
+//! Memory layout of a buffer block.
+struct BufferLayout
+{
+    //! Identifier of the buffer block.
+    std::string                 ident;
+
+    //! Size (in bytes) of the entire buffer block.
+    unsigned int                size    = 0;
+
+    //! Member variables of the buffer block.
+    std::vector<BufferField>    fields;
+};
+
 //! Number of threads within each work group of a compute shader.
 struct NumThreads
 {
@@ -138,6 +173,12 @@ struct ReflectionData
     //! All defined macros after pre-processing.
     std::vector<std::string>            macros;
 
+    //! Paths of all included files (as reported by IncludeHandler::ReportIncludedPath) in the order of their first inclusion (e.g. to write dependency files for incremental builds).
+    std::vector<std::string>            includedFiles;
+
+    //! Sorted identifiers of all macros that influence the output code, i.e. macros that are tested in active '#if'-conditions or expanded in code that is reachable from the entry point.
+    std::vector<std::string>            relevantMacros;
+
     //! Texture bindings.
     std::vector<BindingSlot>            textures;
 
@@ -147,6 +188,14 @@ struct ReflectionData
     //! Constant buffer bindings.
     std::vector<BindingSlot>            constantBuffers;
 
+    /**
+    \brief Memory layouts of all uniform blocks ('std140') and storage buffers ('std430') as they are written to the output code.
+    \remarks Constant buffers are only listed if they are written as uniform blocks (i.e. for GLSL 1.40 and later),
+    or if they are packed into a single 'vec4' array (see Options::packUniforms). Packed constant buffers use the HLSL packing rules.
+    The push constant block is not listed here (see 'pushConstants').
+    */
+    std::vector<BufferLayout>           bufferLayouts;
+
     //! Shader input attributes.
     std::vector<BindingSlot>            inputAttributes;
 
@@ -156,6 +205,15 @@ struct ReflectionData
     //! Static sampler states (identifier, states).
     std::map<std::string, SamplerState> samplerStates;
 
+    //! Specialization constants (identifier, constant ID). This is only used for VKSL output, since other output languages have no specialization constants.
+    std::vector<BindingSlot>            specConstants;
+
+    /**
+    \brief Memory layout of the push constant block (with 'std430' layout rules). This is only used for VKSL output.
+    \remarks If the identifier is empty, no push constant block has been emitted. The push constant block is not listed in 'constantBuffers'.
+    */
+    BufferLayout                        pushConstants;
+
     //! 'numthreads' attribute of a compute shader.
     NumThreads                          numThreads;
 };
@@ -96,6 +96,14 @@ struct Warnings
     };
 };
 
+//! Precision qualifier inference modes for ESSL output.
+enum class PrecisionInference
+{
+    Disabled,       //!< No inference: 'half' types are written with 'mediump', all other floating-point types with 'highp'.
+    Conservative,   //!< Half-precision types are written with 'mediump', unless their values feed the vertex position or texture coordinates.
+    Aggressive,     //!< Like 'Conservative', but local 'float' variables that only carry half-precision values are also written with 'mediump'.
+};
+
 //! Formatting descriptor structure for the output shader.
 struct Formatting
 {
@@ -166,6 +174,37 @@ struct Options
     //! If true, code obfuscation is performed. By default false.
     bool    obfuscate               = false;
 
+    /**
+    \brief If true, the members of each constant buffer are packed into a single 'vec4' array, if uniform blocks are not supported. By default false.
+    \remarks This is only used for GLSL 1.10 - 1.30 and ESSL 1.00, where constant buffers are otherwise written as individual uniforms.
+    The array elements have the same layout as the HLSL constant buffer, so each constant buffer can be uploaded with a single 'glUniform4fv' call.
+    Constant buffers with non floating-point members, structures, or arrays that are not only accessed by an index are not packed.
+    */
+    bool    packUniforms            = false;
+
+    /**
+    \brief Specifies how precision qualifiers are inferred for ESSL output. By default PrecisionInference::Disabled.
+    \remarks The precision of HLSL 'half', 'min16float', and 'min10float' types is propagated through all expressions,
+    and each declaration gets either 'mediump' or 'highp'. This is ignored for all other output languages than ESSL.
+    \see PrecisionInference
+    */
+    PrecisionInference  precisionInference  = PrecisionInference::Disabled;
+
+    /**
+    \brief Maximal size (in bytes) of a constant buffer to be emitted as push constant block for VKSL output. By default 128.
+    \remarks Only constant buffers with the '[vk::push_constant]' attribute are considered, and only one push constant block is emitted per shader.
+    The size is determined with the 'std430' layout rules. If this is 0, no push constant blocks are emitted.
+    */
+    unsigned int        pushConstantLimit   = 128;
+
+    /**
+    \brief If true, pre-processing and parsing run simultaneously on two threads. By default false.
+    \remarks The parser reads the pre-processed code in chunks while the pre-processor is still running, which reduces the latency for large shaders.
+    The reports are the same as without this option. This is ignored if 'preprocessOnly' is enabled.
+    The pre-processor runs on the worker thread, i.e. the include handler (see ShaderInput::includeHandler) is called on that thread.
+    */
+    bool    pipelinedFrontend       = false;
+
     //! If true, the AST (Abstract Syntax Tree) will be written to the log output. By default false.
     bool    showAST                 = false;
 
@@ -219,6 +258,28 @@ struct NameMangling
     bool            renameBufferFields  = false;
 };
 
+/**
+\brief Pre-defined macro structure.
+\remarks This is equivalent to the directive "#define IDENT VALUE" at the beginning of the input source code.
+*/
+struct PredefinedMacro
+{
+    //! Macro identifier with an optional parameter list (e.g. "FOO" or "MUL(a,b)").
+    std::string ident;
+
+    //! Macro value. If this is empty, the macro is defined without a value.
+    std::string value;
+};
+
+/**
+\brief Precompiled prelude (see PrecompilePrelude).
+\remarks The content of this structure is only visible to the compiler.
+*/
+struct Prelude;
+
+//! Shared pointer to a precompiled prelude, which can be used for any number of compilations (also on multiple threads).
+using PreludePtr = std::shared_ptr<const Prelude>;
+
 //! Shader input descriptor structure.
 struct ShaderInput
 {
@@ -255,8 +316,34 @@ struct ShaderInput
     /**
     \brief Optional pointer to the implementation of the "IncludeHandler" interface. By default null.
     \remarks If this is null, the default include handler will be used, which will include files with the STL input file streams.
+    With the pipelined frontend (see Options::pipelinedFrontend), the include handler is called on a worker thread.
     */
     IncludeHandler*                 includeHandler      = nullptr;
+
+    /**
+    \brief List of pre-defined macros. By default empty.
+    \remarks These macros are registered directly in the pre-processor before the input source code is processed,
+    so the source code is not modified and all line numbers are preserved.
+    */
+    std::vector<PredefinedMacro>    predefinedMacros;
+
+    /**
+    \brief Optional precompiled prelude. By default null.
+    \remarks If this is not null, the input source code is compiled as if it was appended to the source code of the prelude,
+    but the prelude itself is not pre-processed again (see PrecompilePrelude).
+    The prelude file and all files it includes are listed in the included files of the reflection data (see Reflection::ReflectionData::includedFiles).
+    */
+    PreludePtr                      prelude;
+
+    /**
+    \brief Optional input stream of a decorated AST from a previous compilation (see ShaderOutput::analyzedAST). By default null.
+    \remarks If this is not null, pre-processing, parsing, and context analysis are skipped, and the input source code is ignored.
+    The AST must have been analyzed with the same shader version, shader target, entry points, and with the same
+    output options that affect the context analysis (i.e. 'preferWrappers' and 'rowMajorAlignment').
+    The identifiers of the input code are only checked against the name mangling prefixes during parsing.
+    Macros and included files are not reflected for such a compilation.
+    */
+    std::shared_ptr<std::istream>   analyzedAST;
 };
 
 //! Vertex shader semantic (or rather attribute) layout structure.
@@ -292,6 +379,13 @@ struct ShaderOutput
     
     //! Specifies the options for name mangling.
     NameMangling                nameMangling;
+
+    /**
+    \brief Optional output stream for the decorated AST in binary format. By default null.
+    \remarks The AST is written after context analysis (before optimization and code generation),
+    so it can be used to generate the output code again with different output options (see ShaderInput::analyzedAST).
+    */
+    std::ostream*               analyzedAST         = nullptr;
 };
 
 /**
@@ -314,6 +408,20 @@ XSC_EXPORT bool CompileShader(
     Reflection::ReflectionData* reflectionData  = nullptr
 );
 
+/**
+\brief Pre-processes the specified prelude (e.g. a shader file with all common include directives) once for multiple compilations.
+\param[in] inputDesc Input descriptor of the prelude. Only the filename, source code, shader version, warnings, include handler,
+pre-defined macros, and prelude are used. Only HLSL is supported.
+\param[in] log Optional pointer to an output log. Inherit from the "Log" class interface. By default null.
+\return Shared pointer to the new precompiled prelude, or null if the pre-processing failed.
+\remarks The prelude contains all macros, included files, and the pre-processed code of its source code.
+Each compilation with this prelude (see ShaderInput::prelude) only pre-processes its own input source code.
+The pre-defined macros of such a compilation are defined after the macros of the prelude, so they do not affect the prelude itself.
+\throw std::invalid_argument If the input stream is null.
+\see ShaderInput::prelude
+*/
+XSC_EXPORT PreludePtr PrecompilePrelude(const ShaderInput& inputDesc, Log* log = nullptr);
+
 
 } // /namespace Xsc
 
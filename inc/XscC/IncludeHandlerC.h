@@ -20,6 +20,7 @@ extern "C" {
 \param[in] searchPaths Specifies an array of include paths. The last entry in this array is NULL.
 \param[in] useSearchPathsFirst Specifies whether search paths are to be used first, to find the include file.
 \return Pointer to the source code of the included file, or NULL to ignore this include directive.
+\remarks With the pipelined frontend (see XscOptions::pipelinedFrontend), this callback is called on a worker thread.
 */
 typedef const char* (*XSC_PFN_HANDLE_INCLUDE)(const char* filename, const char** searchPaths, bool useSearchPathsFirst);
 
@@ -113,6 +113,44 @@ struct XscBindingSlot
     int         location;
 };
 
+//! Member variable of a buffer block with its memory layout.
+struct XscBufferField
+{
+    //! Identifier of the member variable.
+    const char*     ident;
+
+    //! Type name of the member variable (e.g. "float4x4" or "float3[4]").
+    const char*     type;
+
+    //! Offset (in bytes) from the start of the buffer block.
+    unsigned int    offset;
+
+    //! Size (in bytes) of the member variable.
+    unsigned int    size;
+
+    //! Stride (in bytes) between two array elements, or 0 if the member is not an array.
+    unsigned int    arrayStride;
+
+    //! Stride (in bytes) between two matrix columns (or rows for row-major matrices), or 0 if the member is not a matrix.
+    unsigned int    matrixStride;
+};
+
+//! Memory layout of a buffer block.
+struct XscBufferLayout
+{
+    //! Identifier of the buffer block, or NULL if there is no such buffer block.
+    const char*                     ident;
+
+    //! Size (in bytes) of the entire buffer block.
+    unsigned int                    size;
+
+    //! Member variables of the buffer block.
+    const struct XscBufferField*    fields;
+
+    //! Number of elements in 'fields'.
+    size_t                          fieldsCount;
+};
+
 //! Number of threads within each work group of a compute shader.
 struct XscNumThreads
 {
@@ -130,6 +168,18 @@ struct XscReflectionData
     //! Number of elements in 'macros'.
     size_t                          macrosCount;
 
+    //! Paths of all included files (as reported by the include handler) in the order of their first inclusion.
+    const char**                    includedFiles;
+
+    //! Number of elements in 'includedFiles'.
+    size_t                          includedFilesCount;
+
+    //! Sorted identifiers of all macros that influence the output code.
+    const char**                    relevantMacros;
+
+    //! Number of elements in 'relevantMacros'.
+    size_t                          relevantMacrosCount;
+
     //! Texture bindings.
     const struct XscBindingSlot*    textures;
 
@@ -148,6 +198,12 @@ struct XscReflectionData
     //! Number of elements in 'constantBuffers'.
     size_t                          constantBufferCounts;
 
+    //! Memory layouts of all uniform blocks and storage buffers (without the push constant block).
+    const struct XscBufferLayout*   bufferLayouts;
+
+    //! Number of elements in 'bufferLayouts'.
+    size_t                          bufferLayoutsCount;
+
     //! Shader input attributes.
     const struct XscBindingSlot*    inputAttributes;
 
@@ -166,6 +222,15 @@ struct XscReflectionData
     //! Number of elements in 'samplerStates'.
     size_t                          samplerStatesCount;
 
+    //! Specialization constants (identifier, constant ID). This is only used for VKSL output.
+    const struct XscBindingSlot*    specConstants;
+
+    //! Number of elements in 'specConstants'.
+    size_t                          specConstantsCount;
+
+    //! Memory layout of the push constant block (only for VKSL output).
+    struct XscBufferLayout          pushConstants;
+
     //! 'numthreads' attribute of a compute shader.
     struct XscNumThreads            numThreads;
 };
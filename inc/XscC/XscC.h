@@ -40,6 +40,14 @@ enum XscWarnings
     XscWarnAll                      = (~0u),    //!< All warnings.
 };
 
+//! Precision qualifier inference modes for ESSL output.
+enum XscPrecisionInference
+{
+    XscEPrecisionDisabled,      //!< No inference: 'half' types are written with 'mediump', all other floating-point types with 'highp'.
+    XscEPrecisionConservative,  //!< Half-precision types are written with 'mediump', unless their values feed the vertex position or texture coordinates.
+    XscEPrecisionAggressive,    //!< Like 'XscEPrecisionConservative', but local 'float' variables that only carry half-precision values are also written with 'mediump'.
+};
+
 //! Formatting descriptor structure for the output shader.
 struct XscFormatting
 {
@@ -109,6 +117,18 @@ struct XscOptions
     //! If true, code obfuscation is performed. By default false.
     bool    obfuscate;
 
+    //! If true, the members of each constant buffer are packed into a single 'vec4' array, if uniform blocks are not supported (GLSL 1.10 - 1.30 and ESSL 1.00). By default false.
+    bool    packUniforms;
+
+    //! Specifies how precision qualifiers are inferred for ESSL output. By default XscEPrecisionDisabled.
+    enum XscPrecisionInference precisionInference;
+
+    //! Maximal size (in bytes) of a constant buffer with the '[vk::push_constant]' attribute to be emitted as push constant block for VKSL output. By default 128.
+    unsigned int pushConstantLimit;
+
+    //! If true, pre-processing and parsing run simultaneously on two threads. By default false. The include handler is then called on the worker thread.
+    bool    pipelinedFrontend;
+
     //! If true, the AST (Abstract Syntax Tree) will be written to the log output. By default false.
     bool    showAST;
 
@@ -162,6 +182,19 @@ struct XscNameMangling
     bool        renameBufferFields;
 };
 
+/**
+\brief Pre-defined macro structure.
+\remarks This is equivalent to the directive "#define IDENT VALUE" at the beginning of the input source code.
+*/
+struct XscPredefinedMacro
+{
+    //! Macro identifier with an optional parameter list (e.g. "FOO" or "MUL(a,b)").
+    const char* ident;
+
+    //! Macro value. If this is NULL, the macro is defined without a value.
+    const char* value;
+};
+
 //! Shader input descriptor structure.
 struct XscShaderInput
 {
@@ -197,6 +230,12 @@ struct XscShaderInput
 
     //! Include handler member which contains a function pointer to handle '#include'-directives.
     struct XscIncludeHandler        includeHandler;
+
+    //! Optional list of pre-defined macros. By default NULL.
+    const struct XscPredefinedMacro*    predefinedMacros;
+
+    //! Number of elements in the pre-defined macro list. By default 0.
+    size_t                          predefinedMacrosCount;
 };
 
 //! Vertex shader semantic (or rather attribute) layout structure.
@@ -13,6 +13,7 @@
 #include "SymbolTable.h"
 #include "ReportHandler.h"
 #include "ReportIdents.h"
+#include "Helper.h"
 #include <algorithm>
 #include <cctype>
 
@@ -55,6 +56,11 @@ void TypedAST::ResetTypeDenoter()
     bufferedTypeDenoter_.reset();
 }
 
+void TypedAST::SetBufferedTypeDenoter(const TypeDenoterPtr& typeDenoter)
+{
+    bufferedTypeDenoter_ = typeDenoter;
+}
+
 
 /* ----- Expr ----- */
 
@@ -154,16 +160,16 @@ bool Decl::IsAnonymous() const
 
 /* ----- Program ----- */
 
-void Program::RegisterIntrinsicUsage(const Intrinsic intrinsic, const std::vector<DataType>& argumentDataTypes)
+void Program::RegisterIntrinsicUsage(const Intrinsic intrinsic, const IntrinsicUsage::ArgumentList& argList)
 {
-    /* Insert argument types (only base types) into usage list */
-    IntrinsicUsage::ArgumentList argList;
+    const auto idx = INTRINSIC_IDX(intrinsic);
+    if (idx < NUM_INTRINSICS)
     {
-        argList.argTypes.reserve(argumentDataTypes.size());
-        for (auto dataType : argumentDataTypes)
-            argList.argTypes.push_back(dataType);
+        /* Allocate usage table with the first registered intrinsic */
+        if (usedIntrinsics.empty())
+            usedIntrinsics.resize(NUM_INTRINSICS);
+        usedIntrinsics[idx].Insert(argList);
     }
-    usedIntrinsics[intrinsic].argLists.insert(argList);
 }
 
 void Program::RegisterIntrinsicUsage(const Intrinsic intrinsic, const std::vector<ExprPtr>& arguments)
@@ -171,21 +177,23 @@ void Program::RegisterIntrinsicUsage(const Intrinsic intrinsic, const std::vecto
     /* Insert argument types (only base types) into usage list */
     IntrinsicUsage::ArgumentList argList;
     {
-        argList.argTypes.reserve(arguments.size());
         for (auto& arg : arguments)
         {
             const auto& typeDen = arg->GetTypeDenoter()->GetAliased();
             if (auto baseTypeDen = typeDen.As<BaseTypeDenoter>())
-                argList.argTypes.push_back(baseTypeDen->dataType);
+                argList.Append(baseTypeDen->dataType);
         }
     }
-    usedIntrinsics[intrinsic].argLists.insert(argList);
+    RegisterIntrinsicUsage(intrinsic, argList);
 }
 
 const IntrinsicUsage* Program::FetchIntrinsicUsage(const Intrinsic intrinsic) const
 {
-    auto it = usedIntrinsics.find(intrinsic);
-    return (it != usedIntrinsics.end() ? &(it->second) : nullptr);
+    const auto idx = INTRINSIC_IDX(intrinsic);
+    if (idx < usedIntrinsics.size() && usedIntrinsics[idx].IsUsed())
+        return &(usedIntrinsics[idx]);
+    else
+        return nullptr;
 }
 
 
@@ -340,7 +348,7 @@ bool TypeSpecifier::IsOutput() const
 
 bool TypeSpecifier::IsConst() const
 {
-    return (typeModifiers.find(TypeModifier::Const) != typeModifiers.end());
+    return typeModifiers.Contains(TypeModifier::Const);
 }
 
 bool TypeSpecifier::IsConstOrUniform() const
@@ -352,63 +360,45 @@ void TypeSpecifier::SetTypeModifier(const TypeModifier modifier)
 {
     /* Remove overlapping modifier first */
     if (modifier == TypeModifier::RowMajor)
-        typeModifiers.erase(TypeModifier::ColumnMajor);
+        typeModifiers.Remove(TypeModifier::ColumnMajor);
     else if (modifier == TypeModifier::ColumnMajor)
-        typeModifiers.erase(TypeModifier::RowMajor);
+        typeModifiers.Remove(TypeModifier::RowMajor);
 
     /* Insert new modifier */
-    typeModifiers.insert(modifier);
+    typeModifiers.Insert(modifier);
 }
 
-bool TypeSpecifier::HasAnyTypeModifierOf(const std::vector<TypeModifier>& modifiers) const
+bool TypeSpecifier::HasAnyTypeModifierOf(const EnumFlags<TypeModifier>& modifiers) const
 {
-    for (auto mod : modifiers)
-    {
-        if (typeModifiers.find(mod) != typeModifiers.end())
-            return true;
-    }
-    return false;
+    return typeModifiers.Any(modifiers);
 }
 
-bool TypeSpecifier::HasAnyStorageClassesOf(const std::vector<StorageClass>& modifiers) const
+bool TypeSpecifier::HasAnyStorageClassesOf(const EnumFlags<StorageClass>& modifiers) const
 {
-    for (auto mod : modifiers)
-    {
-        if (storageClasses.find(mod) != storageClasses.end())
-            return true;
-    }
-    return false;
+    return storageClasses.Any(modifiers);
 }
 
 void TypeSpecifier::SwapMatrixStorageLayout(const TypeModifier defaultStorgeLayout)
 {
-    bool found = false;
+    const bool rowMajor     = typeModifiers.Contains(TypeModifier::RowMajor);
+    const bool columnMajor  = typeModifiers.Contains(TypeModifier::ColumnMajor);
 
-    /* Construct new type modifier set */
-    std::set<TypeModifier> modifiers;
+    if (rowMajor || columnMajor)
+    {
+        /* Swap matrix storage layouts */
+        typeModifiers.Remove(TypeModifier::RowMajor);
+        typeModifiers.Remove(TypeModifier::ColumnMajor);
 
-    for (auto mod : typeModifiers)
+        if (rowMajor)
+            typeModifiers.Insert(TypeModifier::ColumnMajor);
+        if (columnMajor)
+            typeModifiers.Insert(TypeModifier::RowMajor);
+    }
+    else
     {
-        if (mod == TypeModifier::RowMajor)
-        {
-            modifiers.insert(TypeModifier::ColumnMajor);
-            found = true;
-        }
-        else if (mod == TypeModifier::ColumnMajor)
-        {
-            modifiers.insert(TypeModifier::RowMajor);
-            found = true;
-        }
-        else
-            modifiers.insert(mod);
+        /* If no matrix storage layout has been found, insert the default layout */
+        typeModifiers.Insert(defaultStorgeLayout);
     }
-
-    /* If no matrix storage layout has been found, insert the default layout */
-    if (!found)
-        modifiers.insert(defaultStorgeLayout);
-
-    /* Take new type modifier set */
-    typeModifiers = std::move(modifiers);
 }
 
 
@@ -590,22 +580,15 @@ bool StructDecl::IsCastableTo(const BaseTypeDenoter& rhs) const
 
 VarDecl* StructDecl::FetchVarDecl(const std::string& ident, const StructDecl** owner) const
 {
-    /* Fetch symbol from members first */
-    for (const auto& varDeclStmnt : varMembers)
-    {
-        if (auto symbol = varDeclStmnt->FetchVarDecl(ident))
-        {
-            if (owner)
-                *owner = this;
-            return symbol;
-        }
-    }
+    /* Fetch symbol from member index (members of this structure take precedence over base members) */
+    const auto& entries = GetMemberIndex().entries;
 
-    /* Now fetch symbol from base struct */
-    if (baseStructRef)
+    auto it = entries.find(ident);
+    if (it != entries.end() && it->second.varDecl != nullptr)
     {
-        if (auto symbol = baseStructRef->FetchVarDecl(ident, owner))
-            return symbol;
+        if (owner)
+            *owner = it->second.varDeclOwner;
+        return it->second.varDecl;
     }
 
     return nullptr;
@@ -632,64 +615,42 @@ StructDecl* StructDecl::FetchBaseStructDecl(const std::string& ident)
 FunctionDecl* StructDecl::FetchFunctionDecl(
     const std::string& ident, const std::vector<TypeDenoterPtr>& argTypeDenoters, const StructDecl** owner, bool throwErrorIfNoMatch) const
 {
-    /* Fetch symbol from base struct first */
-    if (baseStructRef)
-    {
-        if (auto symbol = baseStructRef->FetchFunctionDecl(ident, argTypeDenoters, owner))
-            return symbol;
-    }
+    const auto& entries = GetMemberIndex().entries;
 
-    /* Now fetch symbol from members */
-    std::vector<FunctionDecl*> funcDeclList;
-    funcDeclList.reserve(funcMembers.size());
+    auto it = entries.find(ident);
+    if (it == entries.end())
+        return nullptr;
 
-    for (const auto& funcDecl : funcMembers)
+    /* Fetch symbol from base structures first, then from the members of this structure */
+    for (const auto& overloads : it->second.funcOverloads)
     {
-        if (funcDecl->ident.Original() == ident)
-            funcDeclList.push_back(funcDecl.get());
-    }
+        if (owner)
+            *owner = overloads.owner;
 
-    if (funcDeclList.empty())
-        return nullptr;
+        /* Only report an error for the overloads of this structure */
+        const bool throwOnFailure = (throwErrorIfNoMatch && overloads.owner == this);
 
-    if (owner)
-        *owner = this;
+        if (auto symbol = FunctionDecl::FetchFunctionDeclFromList(overloads.funcDecls, ident, argTypeDenoters, throwOnFailure))
+            return symbol;
+    }
 
-    return FunctionDecl::FetchFunctionDeclFromList(funcDeclList, ident, argTypeDenoters, throwErrorIfNoMatch);
+    return nullptr;
 }
 
 std::string StructDecl::FetchSimilar(const std::string& ident)
 {
     /* Collect identifiers of all structure members */
-    std::vector<std::string> similarIdents;
+    SimilarIdentIndex similarIdents;
 
     ForEachVarDecl(
         [&similarIdents](VarDeclPtr& varDecl)
         {
-            similarIdents.push_back(varDecl->ident.Original());
+            similarIdents.Add(varDecl->ident.Original());
         }
     );
 
     /* Find similar identifiers */
-    const std::string* similar = nullptr;
-    unsigned int dist = ~0;
-
-    for (const auto& symbol : similarIdents)
-    {
-        auto d = StringDistance(ident, symbol);
-        if (d < dist)
-        {
-            similar = (&symbol);
-            dist = d;
-        }
-    }
-
-    /* Check if the distance is not too large */
-    if (similar != nullptr && dist < ident.size())
-        return *similar;
-
-    /* No similarities found */
-    return "";
+    return similarIdents.FetchSimilar(ident);
 }
 
 TypeDenoterPtr StructDecl::DeriveTypeDenoter(const TypeDenoter* /*expectedTypeDenoter*/)
@@ -829,6 +790,59 @@ bool StructDecl::IsBaseOf(const StructDecl* subStructDecl, bool includeSelf) con
     return false;
 }
 
+const StructDecl::MemberIndex& StructDecl::GetMemberIndex() const
+{
+    /* Get index of base structure first, which might be rebuilt as well */
+    const MemberIndex* baseIndex = (baseStructRef ? &(baseStructRef->GetMemberIndex()) : nullptr);
+    const auto baseRevision = (baseStructRef ? baseStructRef->memberIndexRevision : 0u);
+
+    /* Return current index if it is still up-to-date */
+    if (memberIndex && memberIndex->baseStruct == baseStructRef && memberIndex->baseRevision == baseRevision)
+        return *memberIndex;
+
+    /* Build new index, starting with the members of the base structure */
+    auto index = MakeUnique<MemberIndex>();
+
+    index->baseStruct   = baseStructRef;
+    index->baseRevision = baseRevision;
+
+    if (baseIndex)
+        index->entries = baseIndex->entries;
+
+    /* Insert member variables (the first declaration within this structure hides all other ones) */
+    for (const auto& varDeclStmnt : varMembers)
+    {
+        for (const auto& varDecl : varDeclStmnt->varDecls)
+        {
+            auto& entry = index->entries[varDecl->ident.Original()];
+            if (entry.varDeclOwner != this)
+            {
+                entry.varDecl       = varDecl.get();
+                entry.varDeclOwner  = this;
+            }
+        }
+    }
+
+    /* Append member function overloads of this structure */
+    for (const auto& funcDecl : funcMembers)
+    {
+        auto& funcOverloads = index->entries[funcDecl->ident.Original()].funcOverloads;
+        if (funcOverloads.empty() || funcOverloads.back().owner != this)
+            funcOverloads.push_back({ this, {} });
+        funcOverloads.back().funcDecls.push_back(funcDecl.get());
+    }
+
+    memberIndex = std::move(index);
+    ++memberIndexRevision;
+
+    return *memberIndex;
+}
+
+void StructDecl::InvalidateMemberIndex()
+{
+    memberIndex.reset();
+}
+
 void StructDecl::AddFlagsRecursive(unsigned int structFlags)
 {
     /* Add flags to this structure */
@@ -1306,7 +1320,7 @@ void VarDeclStmnt::SetTypeModifier(const TypeModifier modifier)
     typeSpecifier->SetTypeModifier(modifier);
 }
 
-bool VarDeclStmnt::HasAnyTypeModifierOf(const std::vector<TypeModifier>& modifiers) const
+bool VarDeclStmnt::HasAnyTypeModifierOf(const EnumFlags<TypeModifier>& modifiers) const
 {
     return typeSpecifier->HasAnyTypeModifierOf(modifiers);
 }
@@ -1347,7 +1361,7 @@ TypeDenoterPtr NullExpr::DeriveTypeDenoter(const TypeDenoter* /*expectedTypeDeno
     Return 'int' as type, because null expressions are only
     used as dynamic array dimensions (which must be integral types)
     */
-    return std::make_shared<BaseTypeDenoter>(DataType::Int);
+    return BaseTypeDenoter::GetCanonical(DataType::Int);
 }
 
 
@@ -1398,7 +1412,7 @@ TypeDenoterPtr LiteralExpr::DeriveTypeDenoter(const TypeDenoter* /*expectedTypeD
     if (IsNull())
         return std::make_shared<NullTypeDenoter>();
     else
-        return std::make_shared<BaseTypeDenoter>(dataType);
+        return BaseTypeDenoter::GetCanonical(dataType);
 }
 
 void LiteralExpr::ConvertDataType(const DataType type)
@@ -1505,7 +1519,7 @@ TypeDenoterPtr TernaryExpr::DeriveTypeDenoter(const TypeDenoter* /*expectedTypeD
             {
                 /* Return common type denoter, based on conditional expression type dimension */
                 const auto subDataType = VectorDataType(baseSubTypeDen->dataType, condVecSize);
-                return std::make_shared<BaseTypeDenoter>(subDataType);
+                return BaseTypeDenoter::GetCanonical(subDataType);
             }
         }
     }
@@ -1981,7 +1995,7 @@ BaseTypeDenoterPtr ObjectExpr::GetTypeDenoterFromSubscript() const
             {
                 /* Get vector type from subscript */
                 auto vectorType = SubscriptDataType(baseTypeDen->dataType, ident);
-                return std::make_shared<BaseTypeDenoter>(vectorType);
+                return BaseTypeDenoter::GetCanonical(vectorType);
             }
             catch (const std::exception& e)
             {
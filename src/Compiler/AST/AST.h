@@ -13,6 +13,8 @@
 #include "Token.h"
 #include "Visitor.h"
 #include "Flags.h"
+#include "EnumFlags.h"
+#include "SparseValue.h"
 #include "ASTEnums.h"
 #include "SourceCode.h"
 #include "TypeDenoter.h"
@@ -21,6 +23,7 @@
 #include <string>
 #include <set>
 #include <map>
+#include <unordered_map>
 #include <functional>
 
 
@@ -88,6 +91,10 @@ using FindPredicateConstFunctor = std::function<bool(const Expr& expr)>;
     IDENT = (1u << (INDEX))
 
 
+// Rarely populated lists of AST nodes, which are only allocated if they are non-empty (see SparseValue).
+using SparseAttributeList   = SparseValue<std::vector<AttributePtr>>;
+using SparseAnnotationList  = SparseValue<std::vector<VarDeclStmntPtr>>;
+
 // Base class for all AST node classes.
 struct AST
 {
@@ -201,8 +208,8 @@ struct Stmnt : public AST
     // Collects all variable-, buffer-, and sampler AST nodes with their identifiers in the specified map.
     virtual void CollectDeclIdents(std::map<const AST*, std::string>& declASTIdents) const;
 
-    std::string                 comment; // Optional commentary for this statement.
-    std::vector<AttributePtr>   attribs; // Attribute list. May be empty.
+    SparseValue<std::string>    comment; // Optional commentary for this statement.
+    SparseAttributeList         attribs; // Attribute list. May be empty.
 };
 
 // AST base class with type denoter.
@@ -217,6 +224,15 @@ struct TypedAST : public AST
         // Resets the buffered type denoter.
         void ResetTypeDenoter();
 
+        // Returns the buffered type denoter without deriving it (may be null).
+        inline const TypeDenoterPtr& GetBufferedTypeDenoter() const
+        {
+            return bufferedTypeDenoter_;
+        }
+
+        // Sets the buffered type denoter (e.g. for a deserialized AST).
+        void SetBufferedTypeDenoter(const TypeDenoterPtr& typeDenoter);
+
     protected:
 
         virtual TypeDenoterPtr DeriveTypeDenoter(const TypeDenoter* expectedTypeDenoter) = 0;
@@ -337,7 +353,7 @@ struct Program : public AST
     };
 
     // Registers a usage of an intrinsic with the specified argument data types (only base types).
-    void RegisterIntrinsicUsage(const Intrinsic intrinsic, const std::vector<DataType>& argumentDataTypes);
+    void RegisterIntrinsicUsage(const Intrinsic intrinsic, const IntrinsicUsage::ArgumentList& argList);
 
     // Registers a usage of an intrinsic with the specified arguments (only base types).
     void RegisterIntrinsicUsage(const Intrinsic intrinsic, const std::vector<ExprPtr>& arguments);
@@ -351,7 +367,7 @@ struct Program : public AST
 
     SourceCodePtr                       sourceCode;                 // Preprocessed source code
     FunctionDecl*                       entryPointRef   = nullptr;  // Reference to the entry point function declaration.
-    std::map<Intrinsic, IntrinsicUsage> usedIntrinsics;             // Set of all used intrinsic (filled by the reference analyzer).
+    std::vector<IntrinsicUsage>         usedIntrinsics;             // Table of all intrinsic usages indexed by INTRINSIC_IDX; empty if no intrinsic is used (filled by the reference analyzer).
 
     LayoutTessControlShader             layoutTessControl;          // Global program layout attributes for a tessellation-control shader.
     LayoutTessEvaluationShader          layoutTessEvaluation;       // Global program layout attributes for a tessellation-evaluation shader.
@@ -451,7 +467,13 @@ struct ArrayDimension : public TypedAST
 struct TypeSpecifier : public TypedAST
 {
     AST_INTERFACE(TypeSpecifier);
-    
+
+    FLAG_ENUM
+    {
+        FLAG( isMediumPrecision, 0 ), // This type has an inferred 'mediump' precision qualifier (only for ESSL output).
+        FLAG( isHighPrecision,   1 ), // This type has an inferred 'highp' precision qualifier (only for ESSL output).
+    };
+
     // Returns the name of this type and all modifiers.
     std::string ToString() const;
 
@@ -476,10 +498,10 @@ struct TypeSpecifier : public TypedAST
     void SetTypeModifier(const TypeModifier modifier);
 
     // Returns true if any of the specified type modifiers is contained.
-    bool HasAnyTypeModifierOf(const std::vector<TypeModifier>& modifiers) const;
+    bool HasAnyTypeModifierOf(const EnumFlags<TypeModifier>& modifiers) const;
 
     // Returns true if any of the specified storage classes is contained.
-    bool HasAnyStorageClassesOf(const std::vector<StorageClass>& modifiers) const;
+    bool HasAnyStorageClassesOf(const EnumFlags<StorageClass>& modifiers) const;
 
     // Swaps the 'row_major' with 'column_major' storage layout, and inserts the specified default layout if none of these are set.
     void SwapMatrixStorageLayout(const TypeModifier defaultStorgeLayout);
@@ -488,9 +510,9 @@ struct TypeSpecifier : public TypedAST
     bool                        isOutput        = false;                    // Input modifier 'out'
     bool                        isUniform       = false;                    // Input modifier 'uniform'
     
-    std::set<StorageClass>      storageClasses;                             // Storage classes, e.g. extern, precise, etc.
-    std::set<InterpModifier>    interpModifiers;                            // Interpolation modifiers, e.g. nointerpolation, linear, centroid etc.
-    std::set<TypeModifier>      typeModifiers;                              // Type modifiers, e.g. const, row_major, column_major (also 'snorm' and 'unorm' for floats)
+    EnumFlags<StorageClass>     storageClasses;                             // Storage classes, e.g. extern, precise, etc.
+    EnumFlags<InterpModifier>   interpModifiers;                            // Interpolation modifiers, e.g. nointerpolation, linear, centroid etc.
+    EnumFlags<TypeModifier>     typeModifiers;                              // Type modifiers, e.g. const, row_major, column_major (also 'snorm' and 'unorm' for floats)
     PrimitiveType               primitiveType   = PrimitiveType::Undefined; // Primitive type for geometry entry pointer parameters
     StructDeclPtr               structDecl;                                 // Optional structure declaration
 
@@ -548,10 +570,11 @@ struct VarDecl : public Decl
     std::vector<ArrayDimensionPtr>  arrayDims;
     IndexedSemantic                 semantic;
     PackOffsetPtr                   packOffset;
-    std::vector<VarDeclStmntPtr>    annotations;                    // Annotations can be ignored by analyzers and generators.
+    SparseAnnotationList            annotations;                    // Annotations can be ignored by analyzers and generators.
     ExprPtr                         initializer;
 
     TypeDenoterPtr                  customTypeDenoter;              // Optional type denoter which can be different from the type of its declaration statement.
+    int                             specConstantId      = -1;       // Specialization constant ID (from 'vk::constant_id' attribute), or -1 if this is no specialization constant.
 
     VarDeclStmnt*                   declStmntRef        = nullptr;  // Reference to its declaration statement (parent node); may be null
     UniformBufferDecl*              bufferDeclRef       = nullptr;  // Reference to its uniform buffer declaration (optional parent-parent-node); may be null
@@ -576,7 +599,7 @@ struct BufferDecl : public Decl
 
     std::vector<ArrayDimensionPtr>  arrayDims;
     std::vector<RegisterPtr>        slotRegisters;
-    std::vector<VarDeclStmntPtr>    annotations;                // Annotations can be ignored by analyzers and generators.
+    SparseAnnotationList            annotations;                // Annotations can be ignored by analyzers and generators.
 
     BufferDeclStmnt*                declStmntRef    = nullptr;  // Reference to its declaration statement (parent node).
 };
@@ -604,6 +627,29 @@ struct StructDecl : public Decl
 {
     AST_INTERFACE(StructDecl);
 
+    // Index entry of all members with the same identifier (including all base structures).
+    struct MemberIndexEntry
+    {
+        // Overloaded member functions of a single structure.
+        struct FunctionOverloads
+        {
+            const StructDecl*           owner;
+            std::vector<FunctionDecl*>  funcDecls;
+        };
+
+        VarDecl*                        varDecl         = nullptr;  // Member variable of the most derived structure that declares it.
+        const StructDecl*               varDeclOwner    = nullptr;
+        std::vector<FunctionOverloads>  funcOverloads;              // Member function overloads in order from the root base structure to this structure.
+    };
+
+    // Lazily built hash index from original member identifiers to their declarations (see 'GetMemberIndex').
+    struct MemberIndex
+    {
+        std::unordered_map<std::string, MemberIndexEntry>   entries;
+        const StructDecl*                                   baseStruct      = nullptr;  // Base structure at the time this index was built.
+        unsigned int                                        baseRevision    = 0;        // Revision of the base structure index at the time this index was built.
+    };
+
     FLAG_ENUM
     {
         FLAG( isShaderInput,        2 ), // This structure is used as shader input.
@@ -674,18 +720,27 @@ struct StructDecl : public Decl
     // Adds the specified flags to this structure, and all parent structures (i.e. all structures that have a member variable with this structure type).
     void AddFlagsRecursiveParents(unsigned int structFlags);
 
+    // Returns the member index of this structure, which is (re-)built on demand if the index of a base structure has changed.
+    const MemberIndex& GetMemberIndex() const;
+
+    // Invalidates the member index. This must be called whenever 'varMembers' or 'funcMembers' are modified after the index has been built.
+    void InvalidateMemberIndex();
+
     std::string                     baseStructName;                     // May be empty (if no inheritance is used).
     std::vector<StmntPtr>           localStmnts;                        // Local declaration statements
 
     std::vector<VarDeclStmntPtr>    varMembers;                         // List of all member variable declaration statements.
     std::vector<FunctionDeclPtr>    funcMembers;                        // List of all member function declarations.
 
-    StructDeclStmnt*                declStmntRef            = nullptr;  // Reference to its declaration statement (parent node).
+    StructDeclStmnt*                declStmntRef            = nullptr;  // Reference to its declaration statement (parent node); may be null
     StructDecl*                     baseStructRef           = nullptr;  // Optional reference to base struct
     std::map<std::string, VarDecl*> systemValuesRef;                    // List of members with system value semantic (SV_...).
     std::vector<StructDecl*>        nestedStructDeclRefs;               // References to all nested structures within this structure.
     std::set<StructDecl*>           parentStructDeclRefs;               // References to all structures that have a member variable with this structure type.
     std::set<VarDecl*>              shaderOutputVarDeclRefs;            // References to all variables from this structure that are used as entry point outputs.
+
+    mutable std::unique_ptr<MemberIndex> memberIndex;                   // Member index (built on demand, see 'GetMemberIndex').
+    mutable unsigned int            memberIndexRevision     = 0;        // Number of times the member index has been built.
 };
 
 // Type alias declaration.
@@ -780,7 +835,7 @@ struct FunctionDecl : public Stmnt
     Identifier                      ident;
     std::vector<VarDeclStmntPtr>    parameters;
     IndexedSemantic                 semantic            = Semantic::Undefined;  // May be undefined
-    std::vector<VarDeclStmntPtr>    annotations;                                // Annotations can be ignored by analyzers and generators.
+    SparseAnnotationList            annotations;                                // Annotations can be ignored by analyzers and generators.
     CodeBlockPtr                    codeBlock;                                  // May be null (if this AST node is a forward declaration).
 
     ParameterSemantics              inputSemantics;                             // Entry point input semantics.
@@ -798,6 +853,12 @@ struct UniformBufferDecl : public Stmnt
 {
     AST_INTERFACE(UniformBufferDecl);
 
+    FLAG_ENUM
+    {
+        FLAG( isPushConstant,   0 ), // This uniform buffer is emitted as push constant block (only for VKSL).
+        FLAG( isPackedUniforms, 1 ), // The members of this uniform buffer are packed into a single 'vec4' array (only without uniform block support).
+    };
+
     std::string ToString() const;
 
     UniformBufferType               bufferType      = UniformBufferType::Undefined;
@@ -879,7 +940,7 @@ struct VarDeclStmnt : public Stmnt
     void SetTypeModifier(const TypeModifier modifier);
 
     // Returns true if any of the specified type modifiers is contained.
-    bool HasAnyTypeModifierOf(const std::vector<TypeModifier>& modifiers) const;
+    bool HasAnyTypeModifierOf(const EnumFlags<TypeModifier>& modifiers) const;
 
     // Iterates over each VarDecl AST node.
     void ForEachVarDecl(const VarDeclIteratorFunctor& iterator);
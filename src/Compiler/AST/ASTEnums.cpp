@@ -1111,6 +1111,43 @@ int GetGatherIntrinsicComponentIndex(const Intrinsic t)
         return 0;
 }
 
+/* ----- IntrinsicUsage Structure ----- */
+
+void IntrinsicUsage::ArgumentList::Append(const DataType dataType)
+{
+    if (numArgs < maxNumArgs)
+        argTypes[numArgs++] = dataType;
+}
+
+bool IntrinsicUsage::ArgumentList::operator == (const ArgumentList& rhs) const
+{
+    return (numArgs == rhs.numArgs && std::equal(argTypes, argTypes + numArgs, rhs.argTypes));
+}
+
+bool IntrinsicUsage::ArgumentList::operator < (const ArgumentList& rhs) const
+{
+    return std::lexicographical_compare(argTypes, argTypes + numArgs, rhs.argTypes, rhs.argTypes + rhs.numArgs);
+}
+
+std::size_t IntrinsicUsage::ArgumentList::Hash::operator () (const ArgumentList& argList) const
+{
+    std::size_t seed = argList.numArgs;
+    for (std::size_t i = 0; i < argList.numArgs; ++i)
+        seed = seed * 31u + static_cast<std::size_t>(argList.argTypes[i]);
+    return seed;
+}
+
+bool IntrinsicUsage::Insert(const ArgumentList& argList)
+{
+    if (argListSet.insert(argList).second)
+    {
+        /* Keep argument lists sorted, since only new argument lists are inserted */
+        argLists.insert(std::upper_bound(argLists.begin(), argLists.end(), argList), argList);
+        return true;
+    }
+    return false;
+}
+
 /* ----- IndexedSemantic Class ----- */
 
 IndexedSemantic::IndexedSemantic(Semantic semantic, int index) :
@@ -12,7 +12,7 @@
 #include <Xsc/Reflection.h>
 #include <string>
 #include <vector>
-#include <set>
+#include <unordered_set>
 
 
 namespace Xsc
@@ -555,6 +555,9 @@ enum class AttributeType
     Partitioning,
     PatchSize,
     PatchConstantFunc,
+
+    ConstantId,
+    PushConstant,
 };
 
 // Returns true if the specified attribute is supported since shader model 3.
@@ -850,21 +853,49 @@ enum class Intrinsic
     Image_AtomicExchange        // GLSL only
 };
 
-// Container structure for all kinds of intrinsic call usages (can be used as std::map<Intrinsic, IntrinsicUsage>
+// Converts the Intrinsic enum value into a zero-based integral.
+#define INTRINSIC_IDX(I) (static_cast<std::size_t>(I) - static_cast<std::size_t>(Intrinsic::Abort))
+
+// Number of all intrinsics (including the GLSL only intrinsics), i.e. the size of a table that is indexed by INTRINSIC_IDX.
+#define NUM_INTRINSICS (INTRINSIC_IDX(Intrinsic::Image_AtomicExchange) + 1u)
+
+// Container structure for all kinds of intrinsic call usages (can be used as table that is indexed by INTRINSIC_IDX).
 struct IntrinsicUsage
 {
+    // Argument data types of an intrinsic call, which are stored inline (no intrinsic has more arguments than 'maxNumArgs').
     struct ArgumentList
     {
-        std::vector<DataType> argTypes;
+        static const std::size_t maxNumArgs = 8;
+
+        // Appends the specified data type. Data types beyond 'maxNumArgs' are ignored.
+        void Append(const DataType dataType);
 
-        inline bool operator < (const ArgumentList& rhs) const
+        bool operator == (const ArgumentList& rhs) const;
+        bool operator < (const ArgumentList& rhs) const;
+
+        struct Hash
         {
-            return (argTypes < rhs.argTypes);
-        }
+            std::size_t operator () (const ArgumentList& argList) const;
+        };
+
+        std::size_t numArgs                 = 0;
+        DataType    argTypes[maxNumArgs]    = {};
     };
 
-    // Set of all argument lists that where used for an intrinsic.
-    std::set<ArgumentList> argLists;
+    // Inserts the specified argument list if it is not already contained, and returns true on success.
+    bool Insert(const ArgumentList& argList);
+
+    // Returns true if this intrinsic has been used at least once.
+    inline bool IsUsed() const
+    {
+        return !argLists.empty();
+    }
+
+    // Sorted list of all distinct argument lists that where used for an intrinsic.
+    std::vector<ArgumentList>                                   argLists;
+
+    // Hash set to find duplicate argument lists.
+    std::unordered_set<ArgumentList, ArgumentList::Hash>        argListSet;
 };
 
 // Returns true if the specified intrinsic is a global intrinsic.
@@ -991,6 +1022,12 @@ class IndexedSemantic
             return index_;
         }
 
+        // Returns the name of the user defined semantic (without index), or an empty string for system value semantics.
+        inline const std::string& UserDefinedName() const
+        {
+            return userDefined_;
+        }
+
     private:
 
         Semantic    semantic_   = Semantic::Undefined;
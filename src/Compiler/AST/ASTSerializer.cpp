@@ -0,0 +1,1677 @@
+/*
+ * ASTSerializer.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ASTSerializer.h"
+#include "AST.h"
+#include "ReportIdents.h"
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <algorithm>
+#include <unordered_map>
+#include <stdexcept>
+#include <sstream>
+
+
+namespace Xsc
+{
+
+
+/*
+ * Internal constants
+ */
+
+static const char           g_astFormatMagic[4] = { 'X', 'A', 'S', 'T' };
+static const std::uint32_t  g_astFormatVersion  = 2;
+
+
+/*
+ * ASTCollector class
+ */
+
+// Archive to collect all AST nodes that are owned by the program (see "SerializeNode" template functions).
+class ASTCollector
+{
+
+    public:
+
+        static const bool isReading = false;
+
+        template <typename T>
+        void Value(T&)
+        {
+        }
+
+        template <typename T>
+        void Enum(T&)
+        {
+        }
+
+        template <typename T>
+        void EnumSet(T&)
+        {
+        }
+
+        template <typename T>
+        void Size(T&)
+        {
+        }
+
+        template <typename T>
+        void Node(std::shared_ptr<T>& ast)
+        {
+            if (ast && ownedNodes_.insert(ast.get()).second)
+                CollectNodeContent(*ast);
+        }
+
+        template <typename T>
+        void Nodes(std::vector<std::shared_ptr<T>>& asts)
+        {
+            for (auto& ast : asts)
+                Node(ast);
+        }
+
+        template <typename T>
+        void Ref(T&)
+        {
+        }
+
+        template <typename T>
+        void Refs(T&)
+        {
+        }
+
+        template <typename T>
+        void RefSet(T&)
+        {
+        }
+
+        template <typename T>
+        void RefMap(T&)
+        {
+        }
+
+        template <typename T>
+        void TypeDen(std::shared_ptr<T>& typeDen)
+        {
+            if (typeDen && typeDens_.insert(typeDen.get()).second)
+                CollectTypeDenoterContent(*typeDen);
+        }
+
+        template <typename T>
+        void IntrinsicUsages(T&)
+        {
+        }
+
+        template <typename T>
+        void Source(T&)
+        {
+        }
+
+        void CollectNodeContent(AST& ast);
+
+        void CollectTypeDenoterContent(TypeDenoter& typeDen);
+
+        // Returns the set of all nodes that are owned by the collected nodes or type denoters.
+        inline const std::set<const AST*>& GetOwnedNodes() const
+        {
+            return ownedNodes_;
+        }
+
+    private:
+
+        std::set<const AST*>            ownedNodes_;
+        std::set<const TypeDenoter*>    typeDens_;
+
+};
+
+
+/*
+ * ASTWriter class
+ */
+
+// Archive to write the AST in binary format (see "SerializeNode" template functions).
+class ASTWriter
+{
+
+    public:
+
+        static const bool isReading = false;
+
+        ASTWriter(std::ostream& stream, const std::set<const AST*>& ownedNodes) :
+            stream_     { stream     },
+            ownedNodes_ { ownedNodes }
+        {
+        }
+
+        // Writes the header with the format version and the input descriptor the AST was analyzed with.
+        void WriteHeader(const ShaderInput& inputDesc)
+        {
+            stream_.write(g_astFormatMagic, sizeof(g_astFormatMagic));
+            WriteUInt(g_astFormatVersion);
+            WriteUInt(static_cast<std::uint64_t>(inputDesc.shaderVersion));
+            WriteUInt(static_cast<std::uint64_t>(inputDesc.shaderTarget));
+            WriteRawString(inputDesc.entryPoint);
+            WriteRawString(inputDesc.secondaryEntryPoint);
+        }
+
+        void Value(bool& value)
+        {
+            WriteUInt(value ? 1 : 0);
+        }
+
+        void Value(int& value)
+        {
+            WriteSInt(value);
+        }
+
+        void Value(unsigned int& value)
+        {
+            WriteUInt(value);
+        }
+
+        void Value(float& value)
+        {
+            std::uint32_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            WriteUInt(bits);
+        }
+
+        // Writes the string only once, all further occurrences are written as index into the string table.
+        void Value(std::string& value)
+        {
+            auto it = stringIndices_.find(value);
+            if (it != stringIndices_.end())
+                WriteUInt(it->second + 1);
+            else
+            {
+                WriteUInt(0);
+                WriteRawString(value);
+                const auto index = stringIndices_.size();
+                stringIndices_[value] = index;
+            }
+        }
+
+        void Value(Flags& value)
+        {
+            WriteUInt(static_cast<unsigned int>(value));
+        }
+
+        void Value(Identifier& value)
+        {
+            auto original   = value.Original();
+            auto renamed    = (value.IsRenamed() ? value.Final() : std::string());
+            Value(original);
+            Value(renamed);
+        }
+
+        void Value(IndexedSemantic& value)
+        {
+            auto name = value.UserDefinedName();
+            WriteUInt(static_cast<std::uint64_t>(static_cast<Semantic>(value)));
+            WriteSInt(value.Index());
+            Value(name);
+        }
+
+        // Writes the source area with the row relative to the previous source area (rows are mostly ascending).
+        void Value(SourceArea& value)
+        {
+            const auto& pos = value.Pos();
+
+            WriteSInt(static_cast<long long>(pos.Row()) - static_cast<long long>(lastRow_));
+            WriteUInt(pos.Column());
+            WriteUInt(value.Length());
+            WriteUInt(value.Offset());
+            lastRow_ = pos.Row();
+
+            if (auto origin = pos.GetOrigin())
+            {
+                auto it = originIndices_.find(origin);
+                if (it != originIndices_.end())
+                    WriteUInt(it->second + 2);
+                else
+                {
+                    WriteUInt(1);
+                    WriteRawString(origin->filename);
+                    WriteSInt(origin->lineOffset);
+                    const auto index = originIndices_.size();
+                    originIndices_[origin] = index;
+                }
+            }
+            else
+                WriteUInt(0);
+        }
+
+        template <typename T>
+        void Enum(T& value)
+        {
+            WriteUInt(static_cast<std::uint64_t>(value));
+        }
+
+        template <typename T>
+        void EnumSet(EnumFlags<T>& values)
+        {
+            WriteUInt(values.BitMask());
+        }
+
+        template <typename T>
+        void Size(std::vector<T>& values)
+        {
+            WriteUInt(values.size());
+        }
+
+        // Writes the AST node by its ID, followed by its content if the node has not already been written.
+        template <typename T>
+        void Node(std::shared_ptr<T>& ast)
+        {
+            if (ast)
+            {
+                WriteUInt(GetNodeID(ast.get()) + 1);
+                if (writtenNodes_.insert(ast.get()).second)
+                    WriteNodeContent(*ast);
+            }
+            else
+                WriteUInt(0);
+        }
+
+        template <typename T>
+        void Nodes(std::vector<std::shared_ptr<T>>& asts)
+        {
+            WriteUInt(asts.size());
+            for (auto& ast : asts)
+                Node(ast);
+        }
+
+        /*
+        Writes a reference to an AST node by its ID. The node itself is written where it is owned.
+        References to nodes that are not owned by the program (e.g. to nodes that have been replaced during parsing)
+        are written as null, since their memory might already be released or reused by another node.
+        */
+        template <typename T>
+        void Ref(T*& ast)
+        {
+            if (ast != nullptr)
+            {
+                auto it = ownedNodes_.find(ast);
+                if (it != ownedNodes_.end() && dynamic_cast<const T*>(*it) != nullptr)
+                {
+                    WriteUInt(GetNodeID(ast) + 1);
+                    return;
+                }
+            }
+            WriteUInt(0);
+        }
+
+        template <typename T>
+        void Refs(std::vector<T*>& asts)
+        {
+            WriteUInt(asts.size());
+            for (auto& ast : asts)
+                Ref(ast);
+        }
+
+        template <typename T>
+        void RefSet(std::set<T*>& asts)
+        {
+            WriteUInt(asts.size());
+            for (auto ast : asts)
+                Ref(ast);
+        }
+
+        template <typename T>
+        void RefMap(std::map<std::string, T*>& asts)
+        {
+            WriteUInt(asts.size());
+            for (auto& entry : asts)
+            {
+                auto key = entry.first;
+                Value(key);
+                Ref(entry.second);
+            }
+        }
+
+        // Writes the type denoter by its ID, followed by its content if the type denoter has not already been written.
+        template <typename T>
+        void TypeDen(std::shared_ptr<T>& typeDen)
+        {
+            if (typeDen)
+            {
+                auto it = typeDenIndices_.find(typeDen.get());
+                if (it != typeDenIndices_.end())
+                    WriteUInt(it->second + 1);
+                else
+                {
+                    const auto index = typeDenIndices_.size();
+                    WriteUInt(index + 1);
+                    typeDenIndices_[typeDen.get()] = index;
+                    WriteTypeDenoterContent(*typeDen);
+                }
+            }
+            else
+                WriteUInt(0);
+        }
+
+        void IntrinsicUsages(std::vector<IntrinsicUsage>& usages)
+        {
+            WriteUInt(std::count_if(usages.begin(), usages.end(), [](const IntrinsicUsage& usage) { return usage.IsUsed(); }));
+            for (std::size_t i = 0; i < usages.size(); ++i)
+            {
+                const auto& usage = usages[i];
+                if (usage.IsUsed())
+                {
+                    WriteUInt(static_cast<std::uint64_t>(Intrinsic::Abort) + i);
+                    WriteUInt(usage.argLists.size());
+                    for (const auto& argList : usage.argLists)
+                    {
+                        WriteUInt(argList.numArgs);
+                        for (std::size_t j = 0; j < argList.numArgs; ++j)
+                            Enum(argList.argTypes[j]);
+                    }
+                }
+            }
+        }
+
+        // Writes all lines of the pre-processed source code that have been read by the parser.
+        void Source(SourceCodePtr& source)
+        {
+            if (source)
+            {
+                WriteUInt(source->Lines().size());
+                for (const auto& line : source->Lines())
+                    WriteRawString(line);
+            }
+            else
+                WriteUInt(0);
+        }
+
+        void WriteNodeContent(AST& ast);
+
+        void WriteTypeDenoterContent(TypeDenoter& typeDen);
+
+    private:
+
+        void WriteUInt(std::uint64_t value)
+        {
+            /* Write 7 bits per byte, the highest bit specifies whether more bytes follow */
+            while (value >= 0x80)
+            {
+                stream_.put(static_cast<char>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            stream_.put(static_cast<char>(value));
+        }
+
+        void WriteSInt(long long value)
+        {
+            /* Zig-zag encoding to write small negative values with few bytes */
+            WriteUInt((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+        }
+
+        void WriteRawString(const std::string& s)
+        {
+            WriteUInt(s.size());
+            stream_.write(s.data(), static_cast<std::streamsize>(s.size()));
+        }
+
+        std::size_t GetNodeID(const AST* ast)
+        {
+            auto it = nodeIndices_.find(ast);
+            if (it == nodeIndices_.end())
+            {
+                it = nodeIndices_.insert({ ast, nodes_.size() }).first;
+                nodes_.push_back(const_cast<AST*>(ast));
+            }
+            return it->second;
+        }
+
+    private:
+
+        std::ostream&                                           stream_;
+        const std::set<const AST*>&                             ownedNodes_;
+
+        std::unordered_map<const AST*, std::size_t>             nodeIndices_;
+        std::vector<AST*>                                       nodes_;
+        std::set<const AST*>                                    writtenNodes_;
+
+        std::unordered_map<const TypeDenoter*, std::size_t>     typeDenIndices_;
+        std::unordered_map<std::string, std::size_t>            stringIndices_;
+        std::unordered_map<const SourceOrigin*, std::size_t>    originIndices_;
+
+        unsigned int                                            lastRow_        = 0;
+
+};
+
+
+/*
+ * ASTReader class
+ */
+
+// Archive to read the AST in binary format (see "SerializeNode" template functions).
+class ASTReader
+{
+
+    public:
+
+        static const bool isReading = true;
+
+        ASTReader(std::istream& stream) :
+            stream_ { stream }
+        {
+        }
+
+        // Reads the header and throws an exception if the format or input descriptor does not match.
+        void ReadHeader(const ShaderInput& inputDesc)
+        {
+            char magic[sizeof(g_astFormatMagic)] = { 0 };
+            stream_.read(magic, sizeof(magic));
+            if (!stream_.good() || std::memcmp(magic, g_astFormatMagic, sizeof(magic)) != 0)
+                throw std::runtime_error(R_InvalidSerializedASTFormat);
+
+            const auto version = ReadUInt();
+            if (version != g_astFormatVersion)
+                throw std::runtime_error(R_SerializedASTVersionMismatch(std::to_string(version), std::to_string(g_astFormatVersion)));
+
+            const auto shaderVersion        = ReadUInt();
+            const auto shaderTarget         = ReadUInt();
+            const auto entryPoint           = ReadRawString();
+            const auto secondaryEntryPoint  = ReadRawString();
+
+            if ( shaderVersion       != static_cast<std::uint64_t>(inputDesc.shaderVersion) ||
+                 shaderTarget        != static_cast<std::uint64_t>(inputDesc.shaderTarget)  ||
+                 entryPoint          != inputDesc.entryPoint                                ||
+                 secondaryEntryPoint != inputDesc.secondaryEntryPoint )
+            {
+                throw std::runtime_error(R_SerializedASTInputMismatch);
+            }
+        }
+
+        void Value(bool& value)
+        {
+            value = (ReadUInt() != 0);
+        }
+
+        void Value(int& value)
+        {
+            value = static_cast<int>(ReadSInt());
+        }
+
+        void Value(unsigned int& value)
+        {
+            value = static_cast<unsigned int>(ReadUInt());
+        }
+
+        void Value(float& value)
+        {
+            auto bits = static_cast<std::uint32_t>(ReadUInt());
+            std::memcpy(&value, &bits, sizeof(value));
+        }
+
+        void Value(std::string& value)
+        {
+            const auto index = ReadUInt();
+            if (index == 0)
+            {
+                value = ReadRawString();
+                strings_.push_back(value);
+            }
+            else if (index <= strings_.size())
+                value = strings_[index - 1];
+            else
+                throw std::runtime_error(R_CorruptedSerializedAST);
+        }
+
+        void Value(Flags& value)
+        {
+            value = Flags(static_cast<unsigned int>(ReadUInt()));
+        }
+
+        void Value(Identifier& value)
+        {
+            std::string original, renamed;
+            Value(original);
+            Value(renamed);
+
+            value = Identifier(original);
+            if (!renamed.empty())
+                value = renamed;
+        }
+
+        void Value(IndexedSemantic& value)
+        {
+            const auto semantic = static_cast<Semantic>(ReadUInt());
+            const auto index    = static_cast<int>(ReadSInt());
+
+            std::string name;
+            Value(name);
+
+            if (semantic == Semantic::UserDefined)
+                value = IndexedSemantic(IndexedSemantic(name), index);
+            else
+                value = IndexedSemantic(semantic, index);
+        }
+
+        void Value(SourceArea& value)
+        {
+            const auto row      = static_cast<unsigned int>(static_cast<long long>(lastRow_) + ReadSInt());
+            const auto column   = static_cast<unsigned int>(ReadUInt());
+            const auto length   = static_cast<unsigned int>(ReadUInt());
+            const auto offset   = static_cast<unsigned int>(ReadUInt());
+            lastRow_ = row;
+
+            const SourceOrigin* origin = nullptr;
+
+            const auto originIndex = ReadUInt();
+            if (originIndex == 1)
+            {
+                /* Source origins are owned by the source code that is read later on (see 'Source') */
+                const auto filename     = ReadRawString();
+                const auto lineOffset   = static_cast<int>(ReadSInt());
+                origin = source_->MakeSourceOrigin(filename, lineOffset);
+                origins_.push_back(origin);
+            }
+            else if (originIndex >= 2)
+            {
+                if (originIndex - 2 >= origins_.size())
+                    throw std::runtime_error(R_CorruptedSerializedAST);
+                origin = origins_[originIndex - 2];
+            }
+
+            value = SourceArea(SourcePosition(row, column, origin), length, offset);
+        }
+
+        template <typename T>
+        void Enum(T& value)
+        {
+            value = static_cast<T>(ReadUInt());
+        }
+
+        template <typename T>
+        void EnumSet(EnumFlags<T>& values)
+        {
+            values = EnumFlags<T>::FromBitMask(static_cast<unsigned int>(ReadUInt()));
+        }
+
+        template <typename T>
+        void Size(std::vector<T>& values)
+        {
+            values.resize(ReadSize());
+        }
+
+        // Reads the AST node by its ID, followed by its content if the node has not already been read.
+        template <typename T>
+        void Node(std::shared_ptr<T>& ast)
+        {
+            const auto id = ReadUInt();
+            if (id > 0)
+            {
+                if (id - 1 < nodes_.size() && nodes_[id - 1])
+                    ast = std::dynamic_pointer_cast<T>(nodes_[id - 1]);
+                else
+                    ast = std::dynamic_pointer_cast<T>(ReadNodeContent(static_cast<std::size_t>(id - 1)));
+                if (!ast)
+                    throw std::runtime_error(R_CorruptedSerializedAST);
+            }
+            else
+                ast = nullptr;
+        }
+
+        template <typename T>
+        void Nodes(std::vector<std::shared_ptr<T>>& asts)
+        {
+            Size(asts);
+            for (auto& ast : asts)
+                Node(ast);
+        }
+
+        // Reads a reference to an AST node, which is resolved after all nodes have been read.
+        template <typename T>
+        void Ref(T*& ast)
+        {
+            ast = nullptr;
+            const auto id = ReadUInt();
+            if (id > 0)
+            {
+                pendingRefs_.push_back(
+                    [this, &ast, id]()
+                    {
+                        ast = ResolveRef<T>(static_cast<std::size_t>(id - 1));
+                    }
+                );
+            }
+        }
+
+        template <typename T>
+        void Refs(std::vector<T*>& asts)
+        {
+            Size(asts);
+            for (auto& ast : asts)
+                Ref(ast);
+        }
+
+        template <typename T>
+        void RefSet(std::set<T*>& asts)
+        {
+            asts.clear();
+            for (auto n = ReadSize(); n > 0; --n)
+            {
+                const auto id = ReadUInt();
+                if (id == 0)
+                    continue;
+                pendingRefs_.push_back(
+                    [this, &asts, id]()
+                    {
+                        asts.insert(ResolveRef<T>(static_cast<std::size_t>(id - 1)));
+                    }
+                );
+            }
+        }
+
+        template <typename T>
+        void RefMap(std::map<std::string, T*>& asts)
+        {
+            asts.clear();
+            for (auto n = ReadSize(); n > 0; --n)
+            {
+                std::string key;
+                Value(key);
+                const auto id = ReadUInt();
+                if (id == 0)
+                    asts[key] = nullptr;
+                else
+                {
+                    pendingRefs_.push_back(
+                        [this, &asts, key, id]()
+                        {
+                            asts[key] = ResolveRef<T>(static_cast<std::size_t>(id - 1));
+                        }
+                    );
+                }
+            }
+        }
+
+        // Reads the type denoter by its ID, followed by its content if the type denoter has not already been read.
+        template <typename T>
+        void TypeDen(std::shared_ptr<T>& typeDen)
+        {
+            const auto id = ReadUInt();
+            if (id > 0)
+            {
+                if (id - 1 < typeDens_.size())
+                    typeDen = std::dynamic_pointer_cast<T>(typeDens_[id - 1]);
+                else if (id - 1 == typeDens_.size())
+                    typeDen = std::dynamic_pointer_cast<T>(ReadTypeDenoterContent());
+                if (!typeDen)
+                    throw std::runtime_error(R_CorruptedSerializedAST);
+            }
+            else
+                typeDen = nullptr;
+        }
+
+        void IntrinsicUsages(std::vector<IntrinsicUsage>& usages)
+        {
+            usages.clear();
+            for (auto n = ReadSize(); n > 0; --n)
+            {
+                const auto idx = INTRINSIC_IDX(ReadUInt());
+                if (idx >= NUM_INTRINSICS)
+                    throw std::runtime_error(R_CorruptedSerializedAST);
+                if (usages.empty())
+                    usages.resize(NUM_INTRINSICS);
+
+                auto& usage = usages[idx];
+                for (auto numArgLists = ReadSize(); numArgLists > 0; --numArgLists)
+                {
+                    IntrinsicUsage::ArgumentList argList;
+                    for (auto numArgs = ReadSize(); numArgs > 0; --numArgs)
+                    {
+                        DataType dataType;
+                        Enum(dataType);
+                        argList.Append(dataType);
+                    }
+                    usage.Insert(argList);
+                }
+            }
+        }
+
+        // Reads all lines of the pre-processed source code into the source code object that owns the source origins.
+        void Source(SourceCodePtr& source)
+        {
+            std::string text;
+            for (auto n = ReadSize(); n > 0; --n)
+                text += ReadRawString();
+
+            /* Remove final new-line character, since the source code appends it to each line */
+            if (!text.empty() && text.back() == '\n')
+                text.pop_back();
+
+            sourceText_->str(text);
+            sourceText_->clear();
+
+            source = source_;
+            while (source->Next() != 0)
+            {
+                /* Read all lines for the line markers of later reports */
+            }
+        }
+
+        // Resolves all pending references to AST nodes.
+        void ResolveRefs()
+        {
+            for (const auto& resolve : pendingRefs_)
+                resolve();
+            pendingRefs_.clear();
+        }
+
+        ASTPtr ReadNodeContent(std::size_t id);
+
+        TypeDenoterPtr ReadTypeDenoterContent();
+
+    private:
+
+        std::uint64_t ReadUInt()
+        {
+            std::uint64_t value = 0;
+
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                const auto byte = stream_.get();
+                if (!stream_.good())
+                    throw std::runtime_error(R_CorruptedSerializedAST);
+
+                value |= (static_cast<std::uint64_t>(byte & 0x7F) << shift);
+
+                if ((byte & 0x80) == 0)
+                    return value;
+            }
+
+            throw std::runtime_error(R_CorruptedSerializedAST);
+        }
+
+        long long ReadSInt()
+        {
+            const auto value = ReadUInt();
+            return static_cast<long long>((value >> 1) ^ (~(value & 1) + 1));
+        }
+
+        // Reads a container size and validates it against the remaining stream size.
+        std::size_t ReadSize()
+        {
+            const auto size = ReadUInt();
+            if (size > (1u << 24))
+                throw std::runtime_error(R_CorruptedSerializedAST);
+            return static_cast<std::size_t>(size);
+        }
+
+        std::string ReadRawString()
+        {
+            std::string s(ReadSize(), '\0');
+            if (!s.empty())
+            {
+                stream_.read(&s[0], static_cast<std::streamsize>(s.size()));
+                if (!stream_.good())
+                    throw std::runtime_error(R_CorruptedSerializedAST);
+            }
+            return s;
+        }
+
+        template <typename T>
+        T* ResolveRef(std::size_t id)
+        {
+            if (id < nodes_.size() && nodes_[id])
+            {
+                if (auto ast = dynamic_cast<T*>(nodes_[id].get()))
+                    return ast;
+            }
+            throw std::runtime_error(R_CorruptedSerializedAST);
+        }
+
+    private:
+
+        std::istream&                       stream_;
+
+        std::vector<ASTPtr>                 nodes_;
+        std::vector<TypeDenoterPtr>         typeDens_;
+        std::vector<std::string>            strings_;
+        std::shared_ptr<std::stringstream>  sourceText_     = std::make_shared<std::stringstream>();
+        SourceCodePtr                       source_         = std::make_shared<SourceCode>(sourceText_);
+        std::vector<const SourceOrigin*>    origins_;
+        std::vector<std::function<void()>>  pendingRefs_;
+
+        unsigned int                        lastRow_        = 0;
+
+};
+
+
+/*
+ * Node serialization (the same functions are used for reading and writing)
+ */
+
+// Serializes the sparse value as its non-sparse type (the value is only allocated on reading if it is non-empty).
+template <typename Archive>
+static void SerializeSparse(Archive& ar, SparseValue<std::string>& value)
+{
+    auto s = value.Get();
+    ar.Value(s);
+    if (Archive::isReading)
+        value = std::move(s);
+}
+
+template <typename Archive, typename T>
+static void SerializeSparse(Archive& ar, SparseValue<std::vector<T>>& asts)
+{
+    auto list = asts.Get();
+    ar.Nodes(list);
+    if (Archive::isReading)
+        asts = std::move(list);
+}
+
+template <typename Archive>
+static void SerializeStmnt(Archive& ar, Stmnt& ast)
+{
+    SerializeSparse(ar, ast.comment);
+    SerializeSparse(ar, ast.attribs);
+}
+
+template <typename Archive>
+static void SerializeTypedAST(Archive& ar, TypedAST& ast)
+{
+    /* Keep buffered type denoter, since some type denoters can only be derived with an expected type (e.g. for initializers) */
+    auto typeDen = ast.GetBufferedTypeDenoter();
+    ar.TypeDen(typeDen);
+    if (Archive::isReading)
+        ast.SetBufferedTypeDenoter(typeDen);
+}
+
+template <typename Archive>
+static void SerializeDecl(Archive& ar, Decl& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Value(ast.ident);
+}
+
+template <typename Archive>
+static void SerializeProgram(Archive& ar, Program& ast)
+{
+    ar.Nodes(ast.globalStmnts);
+    ar.Nodes(ast.disabledAST);
+    ar.Source(ast.sourceCode);
+    ar.Ref(ast.entryPointRef);
+    ar.IntrinsicUsages(ast.usedIntrinsics);
+
+    ar.Value(ast.layoutTessControl.outputControlPoints);
+    ar.Value(ast.layoutTessControl.maxTessFactor);
+    ar.Ref(ast.layoutTessControl.patchConstFunctionRef);
+
+    ar.Enum(ast.layoutTessEvaluation.domainType);
+    ar.Enum(ast.layoutTessEvaluation.partitioning);
+    ar.Enum(ast.layoutTessEvaluation.outputTopology);
+
+    ar.Enum(ast.layoutGeometry.inputPrimitive);
+    ar.Enum(ast.layoutGeometry.outputPrimitive);
+    ar.Value(ast.layoutGeometry.maxVertices);
+
+    ar.Value(ast.layoutFragment.fragCoordUsed);
+    ar.Value(ast.layoutFragment.pixelCenterInteger);
+    ar.Value(ast.layoutFragment.earlyDepthStencil);
+
+    for (auto& numThreads : ast.layoutCompute.numThreads)
+        ar.Value(numThreads);
+}
+
+template <typename Archive>
+static void SerializeCodeBlock(Archive& ar, CodeBlock& ast)
+{
+    ar.Nodes(ast.stmnts);
+}
+
+template <typename Archive>
+static void SerializeAttribute(Archive& ar, Attribute& ast)
+{
+    ar.Enum(ast.attributeType);
+    ar.Nodes(ast.arguments);
+}
+
+template <typename Archive>
+static void SerializeSwitchCase(Archive& ar, SwitchCase& ast)
+{
+    ar.Node(ast.expr);
+    ar.Nodes(ast.stmnts);
+}
+
+template <typename Archive>
+static void SerializeSamplerValue(Archive& ar, SamplerValue& ast)
+{
+    ar.Value(ast.name);
+    ar.Node(ast.value);
+}
+
+template <typename Archive>
+static void SerializeRegister(Archive& ar, Register& ast)
+{
+    ar.Enum(ast.shaderTarget);
+    ar.Enum(ast.registerType);
+    ar.Value(ast.slot);
+}
+
+template <typename Archive>
+static void SerializePackOffset(Archive& ar, PackOffset& ast)
+{
+    ar.Value(ast.registerName);
+    ar.Value(ast.vectorComponent);
+}
+
+template <typename Archive>
+static void SerializeArrayDimension(Archive& ar, ArrayDimension& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Node(ast.expr);
+    ar.Value(ast.size);
+}
+
+template <typename Archive>
+static void SerializeTypeSpecifier(Archive& ar, TypeSpecifier& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Value(ast.isInput);
+    ar.Value(ast.isOutput);
+    ar.Value(ast.isUniform);
+    ar.EnumSet(ast.storageClasses);
+    ar.EnumSet(ast.interpModifiers);
+    ar.EnumSet(ast.typeModifiers);
+    ar.Enum(ast.primitiveType);
+    ar.Node(ast.structDecl);
+    ar.TypeDen(ast.typeDenoter);
+}
+
+template <typename Archive>
+static void SerializeVarDecl(Archive& ar, VarDecl& ast)
+{
+    SerializeDecl(ar, ast);
+    ar.Node(ast.namespaceExpr);
+    ar.Nodes(ast.arrayDims);
+    ar.Value(ast.semantic);
+    ar.Node(ast.packOffset);
+    SerializeSparse(ar, ast.annotations);
+    ar.Node(ast.initializer);
+    ar.TypeDen(ast.customTypeDenoter);
+    ar.Value(ast.specConstantId);
+    ar.Ref(ast.declStmntRef);
+    ar.Ref(ast.bufferDeclRef);
+    ar.Ref(ast.structDeclRef);
+    ar.Ref(ast.staticMemberVarRef);
+}
+
+template <typename Archive>
+static void SerializeBufferDecl(Archive& ar, BufferDecl& ast)
+{
+    SerializeDecl(ar, ast);
+    ar.Nodes(ast.arrayDims);
+    ar.Nodes(ast.slotRegisters);
+    SerializeSparse(ar, ast.annotations);
+    ar.Ref(ast.declStmntRef);
+}
+
+template <typename Archive>
+static void SerializeSamplerDecl(Archive& ar, SamplerDecl& ast)
+{
+    SerializeDecl(ar, ast);
+    ar.Nodes(ast.arrayDims);
+    ar.Nodes(ast.slotRegisters);
+    ar.Value(ast.textureIdent);
+    ar.Nodes(ast.samplerValues);
+    ar.Ref(ast.declStmntRef);
+}
+
+template <typename Archive>
+static void SerializeStructDecl(Archive& ar, StructDecl& ast)
+{
+    SerializeDecl(ar, ast);
+    ar.Value(ast.baseStructName);
+    ar.Nodes(ast.localStmnts);
+    ar.Nodes(ast.varMembers);
+    ar.Nodes(ast.funcMembers);
+    ar.Ref(ast.declStmntRef);
+    ar.Ref(ast.baseStructRef);
+    ar.RefMap(ast.systemValuesRef);
+    ar.Refs(ast.nestedStructDeclRefs);
+    ar.RefSet(ast.parentStructDeclRefs);
+    ar.RefSet(ast.shaderOutputVarDeclRefs);
+}
+
+template <typename Archive>
+static void SerializeAliasDecl(Archive& ar, AliasDecl& ast)
+{
+    SerializeDecl(ar, ast);
+    ar.TypeDen(ast.typeDenoter);
+    ar.Ref(ast.declStmntRef);
+}
+
+template <typename Archive>
+static void SerializeFunctionDecl(Archive& ar, FunctionDecl& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Node(ast.returnType);
+    ar.Value(ast.ident);
+    ar.Nodes(ast.parameters);
+    ar.Value(ast.semantic);
+    SerializeSparse(ar, ast.annotations);
+    ar.Node(ast.codeBlock);
+    ar.Refs(ast.inputSemantics.varDeclRefs);
+    ar.Refs(ast.inputSemantics.varDeclRefsSV);
+    ar.Refs(ast.outputSemantics.varDeclRefs);
+    ar.Refs(ast.outputSemantics.varDeclRefsSV);
+    ar.Ref(ast.funcImplRef);
+    ar.Refs(ast.funcForwardDeclRefs);
+    ar.Ref(ast.structDeclRef);
+
+    ar.Size(ast.paramStructs);
+    for (auto& paramStruct : ast.paramStructs)
+    {
+        ar.Ref(paramStruct.expr);
+        ar.Ref(paramStruct.varDecl);
+        ar.Ref(paramStruct.structDecl);
+    }
+}
+
+template <typename Archive>
+static void SerializeUniformBufferDecl(Archive& ar, UniformBufferDecl& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Enum(ast.bufferType);
+    ar.Value(ast.ident);
+    ar.Nodes(ast.slotRegisters);
+    ar.Nodes(ast.localStmnts);
+    ar.Nodes(ast.varMembers);
+}
+
+template <typename Archive>
+static void SerializeBufferDeclStmnt(Archive& ar, BufferDeclStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.TypeDen(ast.typeDenoter);
+    ar.Nodes(ast.bufferDecls);
+}
+
+template <typename Archive>
+static void SerializeSamplerDeclStmnt(Archive& ar, SamplerDeclStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.TypeDen(ast.typeDenoter);
+    ar.Nodes(ast.samplerDecls);
+}
+
+template <typename Archive>
+static void SerializeStructDeclStmnt(Archive& ar, StructDeclStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Node(ast.structDecl);
+}
+
+template <typename Archive>
+static void SerializeVarDeclStmnt(Archive& ar, VarDeclStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Node(ast.typeSpecifier);
+    ar.Nodes(ast.varDecls);
+}
+
+template <typename Archive>
+static void SerializeAliasDeclStmnt(Archive& ar, AliasDeclStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Node(ast.structDecl);
+    ar.Nodes(ast.aliasDecls);
+}
+
+template <typename Archive>
+static void SerializeNullStmnt(Archive& ar, NullStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+}
+
+template <typename Archive>
+static void SerializeCodeBlockStmnt(Archive& ar, CodeBlockStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Node(ast.codeBlock);
+}
+
+template <typename Archive>
+static void SerializeForLoopStmnt(Archive& ar, ForLoopStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Node(ast.initStmnt);
+    ar.Node(ast.condition);
+    ar.Node(ast.iteration);
+    ar.Node(ast.bodyStmnt);
+}
+
+template <typename Archive>
+static void SerializeWhileLoopStmnt(Archive& ar, WhileLoopStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Node(ast.condition);
+    ar.Node(ast.bodyStmnt);
+}
+
+template <typename Archive>
+static void SerializeDoWhileLoopStmnt(Archive& ar, DoWhileLoopStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Node(ast.bodyStmnt);
+    ar.Node(ast.condition);
+}
+
+template <typename Archive>
+static void SerializeIfStmnt(Archive& ar, IfStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Node(ast.condition);
+    ar.Node(ast.bodyStmnt);
+    ar.Node(ast.elseStmnt);
+}
+
+template <typename Archive>
+static void SerializeElseStmnt(Archive& ar, ElseStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Node(ast.bodyStmnt);
+}
+
+template <typename Archive>
+static void SerializeSwitchStmnt(Archive& ar, SwitchStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Node(ast.selector);
+    ar.Nodes(ast.cases);
+}
+
+template <typename Archive>
+static void SerializeExprStmnt(Archive& ar, ExprStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Node(ast.expr);
+}
+
+template <typename Archive>
+static void SerializeReturnStmnt(Archive& ar, ReturnStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Node(ast.expr);
+}
+
+template <typename Archive>
+static void SerializeCtrlTransferStmnt(Archive& ar, CtrlTransferStmnt& ast)
+{
+    SerializeStmnt(ar, ast);
+    ar.Enum(ast.transfer);
+}
+
+template <typename Archive>
+static void SerializeNullExpr(Archive& ar, NullExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+}
+
+template <typename Archive>
+static void SerializeSequenceExpr(Archive& ar, SequenceExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Nodes(ast.exprs);
+}
+
+template <typename Archive>
+static void SerializeLiteralExpr(Archive& ar, LiteralExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Enum(ast.dataType);
+    ar.Value(ast.value);
+}
+
+template <typename Archive>
+static void SerializeTypeSpecifierExpr(Archive& ar, TypeSpecifierExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Node(ast.typeSpecifier);
+}
+
+template <typename Archive>
+static void SerializeTernaryExpr(Archive& ar, TernaryExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Node(ast.condExpr);
+    ar.Node(ast.thenExpr);
+    ar.Node(ast.elseExpr);
+}
+
+template <typename Archive>
+static void SerializeBinaryExpr(Archive& ar, BinaryExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Node(ast.lhsExpr);
+    ar.Enum(ast.op);
+    ar.Node(ast.rhsExpr);
+}
+
+template <typename Archive>
+static void SerializeUnaryExpr(Archive& ar, UnaryExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Enum(ast.op);
+    ar.Node(ast.expr);
+}
+
+template <typename Archive>
+static void SerializePostUnaryExpr(Archive& ar, PostUnaryExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Node(ast.expr);
+    ar.Enum(ast.op);
+}
+
+template <typename Archive>
+static void SerializeCallExpr(Archive& ar, CallExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Node(ast.prefixExpr);
+    ar.Value(ast.isStatic);
+    ar.Value(ast.ident);
+    ar.TypeDen(ast.typeDenoter);
+    ar.Nodes(ast.arguments);
+    ar.Ref(ast.funcDeclRef);
+    ar.Enum(ast.intrinsic);
+    ar.Refs(ast.defaultArgumentRefs);
+}
+
+template <typename Archive>
+static void SerializeBracketExpr(Archive& ar, BracketExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Node(ast.expr);
+}
+
+template <typename Archive>
+static void SerializeObjectExpr(Archive& ar, ObjectExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Node(ast.prefixExpr);
+    ar.Value(ast.isStatic);
+    ar.Value(ast.ident);
+    ar.Ref(ast.symbolRef);
+}
+
+template <typename Archive>
+static void SerializeAssignExpr(Archive& ar, AssignExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Node(ast.lvalueExpr);
+    ar.Enum(ast.op);
+    ar.Node(ast.rvalueExpr);
+}
+
+template <typename Archive>
+static void SerializeArrayExpr(Archive& ar, ArrayExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Node(ast.prefixExpr);
+    ar.Nodes(ast.arrayIndices);
+}
+
+template <typename Archive>
+static void SerializeCastExpr(Archive& ar, CastExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Node(ast.typeSpecifier);
+    ar.Node(ast.expr);
+}
+
+template <typename Archive>
+static void SerializeInitializerExpr(Archive& ar, InitializerExpr& ast)
+{
+    SerializeTypedAST(ar, ast);
+    ar.Nodes(ast.exprs);
+}
+
+// Serializes the flags and all members of the specified AST node (the source area is serialized before the node is allocated).
+template <typename Archive>
+static void SerializeNode(Archive& ar, AST& ast)
+{
+    ar.Value(ast.flags);
+
+    #define SERIALIZE_NODE(CLASS_NAME)                                  \
+        case AST::Types::CLASS_NAME:                                    \
+            Serialize##CLASS_NAME(ar, static_cast<CLASS_NAME&>(ast));   \
+            break
+
+    switch (ast.Type())
+    {
+        SERIALIZE_NODE( Program           );
+        SERIALIZE_NODE( CodeBlock         );
+        SERIALIZE_NODE( Attribute         );
+        SERIALIZE_NODE( SwitchCase        );
+        SERIALIZE_NODE( SamplerValue      );
+        SERIALIZE_NODE( Register          );
+        SERIALIZE_NODE( PackOffset        );
+        SERIALIZE_NODE( ArrayDimension    );
+        SERIALIZE_NODE( TypeSpecifier     );
+
+        SERIALIZE_NODE( VarDecl           );
+        SERIALIZE_NODE( BufferDecl        );
+        SERIALIZE_NODE( SamplerDecl       );
+        SERIALIZE_NODE( StructDecl        );
+        SERIALIZE_NODE( AliasDecl         );
+
+        SERIALIZE_NODE( FunctionDecl      );
+        SERIALIZE_NODE( UniformBufferDecl );
+        SERIALIZE_NODE( VarDeclStmnt      );
+        SERIALIZE_NODE( BufferDeclStmnt   );
+        SERIALIZE_NODE( SamplerDeclStmnt  );
+        SERIALIZE_NODE( StructDeclStmnt   );
+        SERIALIZE_NODE( AliasDeclStmnt    );
+
+        SERIALIZE_NODE( NullStmnt         );
+        SERIALIZE_NODE( CodeBlockStmnt    );
+        SERIALIZE_NODE( ForLoopStmnt      );
+        SERIALIZE_NODE( WhileLoopStmnt    );
+        SERIALIZE_NODE( DoWhileLoopStmnt  );
+        SERIALIZE_NODE( IfStmnt           );
+        SERIALIZE_NODE( ElseStmnt         );
+        SERIALIZE_NODE( SwitchStmnt       );
+        SERIALIZE_NODE( ExprStmnt         );
+        SERIALIZE_NODE( ReturnStmnt       );
+        SERIALIZE_NODE( CtrlTransferStmnt );
+
+        SERIALIZE_NODE( NullExpr          );
+        SERIALIZE_NODE( SequenceExpr      );
+        SERIALIZE_NODE( LiteralExpr       );
+        SERIALIZE_NODE( TypeSpecifierExpr );
+        SERIALIZE_NODE( TernaryExpr       );
+        SERIALIZE_NODE( BinaryExpr        );
+        SERIALIZE_NODE( UnaryExpr         );
+        SERIALIZE_NODE( PostUnaryExpr     );
+        SERIALIZE_NODE( CallExpr          );
+        SERIALIZE_NODE( BracketExpr       );
+        SERIALIZE_NODE( ObjectExpr        );
+        SERIALIZE_NODE( AssignExpr        );
+        SERIALIZE_NODE( ArrayExpr         );
+        SERIALIZE_NODE( CastExpr          );
+        SERIALIZE_NODE( InitializerExpr   );
+    }
+
+    #undef SERIALIZE_NODE
+}
+
+// Serializes all members of the specified type denoter (the type is serialized before the type denoter is allocated).
+template <typename Archive>
+static void SerializeTypeDenoter(Archive& ar, TypeDenoter& typeDen)
+{
+    switch (typeDen.Type())
+    {
+        case TypeDenoter::Types::Void:
+        case TypeDenoter::Types::Null:
+            break;
+
+        case TypeDenoter::Types::Base:
+        {
+            auto& baseTypeDen = static_cast<BaseTypeDenoter&>(typeDen);
+            ar.Enum(baseTypeDen.dataType);
+        }
+        break;
+
+        case TypeDenoter::Types::Buffer:
+        {
+            auto& bufferTypeDen = static_cast<BufferTypeDenoter&>(typeDen);
+            ar.Enum(bufferTypeDen.bufferType);
+            ar.TypeDen(bufferTypeDen.genericTypeDenoter);
+            ar.Value(bufferTypeDen.genericSize);
+            ar.Ref(bufferTypeDen.bufferDeclRef);
+        }
+        break;
+
+        case TypeDenoter::Types::Sampler:
+        {
+            auto& samplerTypeDen = static_cast<SamplerTypeDenoter&>(typeDen);
+            ar.Enum(samplerTypeDen.samplerType);
+            ar.Ref(samplerTypeDen.samplerDeclRef);
+        }
+        break;
+
+        case TypeDenoter::Types::Struct:
+        {
+            auto& structTypeDen = static_cast<StructTypeDenoter&>(typeDen);
+            ar.Value(structTypeDen.ident);
+            ar.Ref(structTypeDen.structDeclRef);
+        }
+        break;
+
+        case TypeDenoter::Types::Alias:
+        {
+            auto& aliasTypeDen = static_cast<AliasTypeDenoter&>(typeDen);
+            ar.Value(aliasTypeDen.ident);
+            ar.Ref(aliasTypeDen.aliasDeclRef);
+        }
+        break;
+
+        case TypeDenoter::Types::Array:
+        {
+            auto& arrayTypeDen = static_cast<ArrayTypeDenoter&>(typeDen);
+            ar.TypeDen(arrayTypeDen.subTypeDenoter);
+            ar.Nodes(arrayTypeDen.arrayDims);
+        }
+        break;
+    }
+}
+
+
+/*
+ * ASTCollector class (out-of-line functions)
+ */
+
+void ASTCollector::CollectNodeContent(AST& ast)
+{
+    SerializeNode(*this, ast);
+}
+
+void ASTCollector::CollectTypeDenoterContent(TypeDenoter& typeDen)
+{
+    SerializeTypeDenoter(*this, typeDen);
+}
+
+
+/*
+ * ASTWriter class (out-of-line functions)
+ */
+
+void ASTWriter::WriteNodeContent(AST& ast)
+{
+    WriteUInt(static_cast<std::uint64_t>(ast.Type()));
+    Value(ast.area);
+    SerializeNode(*this, ast);
+}
+
+void ASTWriter::WriteTypeDenoterContent(TypeDenoter& typeDen)
+{
+    WriteUInt(static_cast<std::uint64_t>(typeDen.Type()));
+    SerializeTypeDenoter(*this, typeDen);
+}
+
+
+/*
+ * ASTReader class (out-of-line functions)
+ */
+
+ASTPtr ASTReader::ReadNodeContent(std::size_t id)
+{
+    if (id >= (1u << 24))
+        throw std::runtime_error(R_CorruptedSerializedAST);
+
+    const auto type = static_cast<AST::Types>(ReadUInt());
+
+    SourceArea area;
+    Value(area);
+
+    ASTPtr ast;
+
+    #define MAKE_NODE(CLASS_NAME)                               \
+        case AST::Types::CLASS_NAME:                            \
+            ast = std::make_shared<CLASS_NAME>(area);           \
+            break
+
+    switch (type)
+    {
+        MAKE_NODE( Program           );
+        MAKE_NODE( CodeBlock         );
+        MAKE_NODE( Attribute         );
+        MAKE_NODE( SwitchCase        );
+        MAKE_NODE( SamplerValue      );
+        MAKE_NODE( Register          );
+        MAKE_NODE( PackOffset        );
+        MAKE_NODE( ArrayDimension    );
+        MAKE_NODE( TypeSpecifier     );
+
+        MAKE_NODE( VarDecl           );
+        MAKE_NODE( BufferDecl        );
+        MAKE_NODE( SamplerDecl       );
+        MAKE_NODE( StructDecl        );
+        MAKE_NODE( AliasDecl         );
+
+        MAKE_NODE( FunctionDecl      );
+        MAKE_NODE( UniformBufferDecl );
+        MAKE_NODE( VarDeclStmnt      );
+        MAKE_NODE( BufferDeclStmnt   );
+        MAKE_NODE( SamplerDeclStmnt  );
+        MAKE_NODE( StructDeclStmnt   );
+        MAKE_NODE( AliasDeclStmnt    );
+
+        MAKE_NODE( NullStmnt         );
+        MAKE_NODE( CodeBlockStmnt    );
+        MAKE_NODE( ForLoopStmnt      );
+        MAKE_NODE( WhileLoopStmnt    );
+        MAKE_NODE( DoWhileLoopStmnt  );
+        MAKE_NODE( IfStmnt           );
+        MAKE_NODE( ElseStmnt         );
+        MAKE_NODE( SwitchStmnt       );
+        MAKE_NODE( ExprStmnt         );
+        MAKE_NODE( ReturnStmnt       );
+        MAKE_NODE( CtrlTransferStmnt );
+
+        MAKE_NODE( NullExpr          );
+        MAKE_NODE( SequenceExpr      );
+        MAKE_NODE( LiteralExpr       );
+        MAKE_NODE( TypeSpecifierExpr );
+        MAKE_NODE( TernaryExpr       );
+        MAKE_NODE( BinaryExpr        );
+        MAKE_NODE( UnaryExpr         );
+        MAKE_NODE( PostUnaryExpr     );
+        MAKE_NODE( CallExpr          );
+        MAKE_NODE( BracketExpr       );
+        MAKE_NODE( ObjectExpr        );
+        MAKE_NODE( AssignExpr        );
+        MAKE_NODE( ArrayExpr         );
+        MAKE_NODE( CastExpr          );
+        MAKE_NODE( InitializerExpr   );
+
+        default:
+            throw std::runtime_error(R_CorruptedSerializedAST);
+    }
+
+    #undef MAKE_NODE
+
+    /* Register node before its content is read, so the content can refer to it */
+    if (id >= nodes_.size())
+        nodes_.resize(id + 1);
+    nodes_[id] = ast;
+
+    SerializeNode(*this, *ast);
+
+    return ast;
+}
+
+TypeDenoterPtr ASTReader::ReadTypeDenoterContent()
+{
+    TypeDenoterPtr typeDen;
+
+    switch (static_cast<TypeDenoter::Types>(ReadUInt()))
+    {
+        case TypeDenoter::Types::Void:
+            typeDen = std::make_shared<VoidTypeDenoter>();
+            break;
+        case TypeDenoter::Types::Null:
+            typeDen = std::make_shared<NullTypeDenoter>();
+            break;
+        case TypeDenoter::Types::Base:
+            typeDen = std::make_shared<BaseTypeDenoter>();
+            break;
+        case TypeDenoter::Types::Buffer:
+            typeDen = std::make_shared<BufferTypeDenoter>();
+            break;
+        case TypeDenoter::Types::Sampler:
+            typeDen = std::make_shared<SamplerTypeDenoter>();
+            break;
+        case TypeDenoter::Types::Struct:
+            typeDen = std::make_shared<StructTypeDenoter>();
+            break;
+        case TypeDenoter::Types::Alias:
+            typeDen = std::make_shared<AliasTypeDenoter>();
+            break;
+        case TypeDenoter::Types::Array:
+            typeDen = std::make_shared<ArrayTypeDenoter>();
+            break;
+        default:
+            throw std::runtime_error(R_CorruptedSerializedAST);
+    }
+
+    /* Register type denoter before its content is read (IDs are assigned in the order of their first occurrence) */
+    typeDens_.push_back(typeDen);
+
+    SerializeTypeDenoter(*this, *typeDen);
+
+    return typeDen;
+}
+
+
+/*
+ * Global functions
+ */
+
+void SerializeAST(const Program& program, const ShaderInput& inputDesc, std::ostream& stream)
+{
+    /* Use program as root node (the archives do not modify the program, but use the same functions as the reader) */
+    ProgramPtr root(const_cast<Program*>(&program), [](Program*) {});
+
+    /* Collect all owned nodes first, to only write references to nodes that are part of the program */
+    ASTCollector collector;
+    collector.Node(root);
+
+    ASTWriter writer(stream, collector.GetOwnedNodes());
+
+    writer.WriteHeader(inputDesc);
+    writer.Node(root);
+}
+
+ProgramPtr DeserializeAST(std::istream& stream, const ShaderInput& inputDesc)
+{
+    ASTReader reader(stream);
+
+    reader.ReadHeader(inputDesc);
+
+    ProgramPtr program;
+    reader.Node(program);
+    if (!program)
+        throw std::runtime_error(R_CorruptedSerializedAST);
+
+    reader.ResolveRefs();
+
+    return program;
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
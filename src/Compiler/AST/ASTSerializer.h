@@ -0,0 +1,43 @@
+/*
+ * ASTSerializer.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_AST_SERIALIZER_H
+#define XSC_AST_SERIALIZER_H
+
+
+#include <Xsc/Xsc.h>
+#include "Visitor.h"
+#include <istream>
+#include <ostream>
+
+
+namespace Xsc
+{
+
+
+/*
+Binary serialization of the decorated AST (i.e. after context analysis), so the code generation can be repeated without the frontend.
+The format contains all AST nodes and type denoters (shared nodes are only written once), all references between them,
+the used intrinsics, the layout meta data, and the pre-processed source code for the line markers of later reports.
+The format is only compatible with the same format version, and the same input shader version, shader target, and entry points.
+*/
+
+// Writes the specified decorated program in binary format to the output stream.
+void SerializeAST(const Program& program, const ShaderInput& inputDesc, std::ostream& stream);
+
+// Reads a decorated program in binary format from the input stream, or throws an std::runtime_error on failure.
+ProgramPtr DeserializeAST(std::istream& stream, const ShaderInput& inputDesc);
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
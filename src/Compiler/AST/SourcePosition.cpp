@@ -14,7 +14,7 @@ namespace Xsc
 
 const SourcePosition SourcePosition::ignore {};
 
-SourcePosition::SourcePosition(unsigned int row, unsigned int column, const SourceOriginPtr& origin) :
+SourcePosition::SourcePosition(unsigned int row, unsigned int column, const SourceOrigin* origin) :
     row_   { row    },
     column_{ column },
     origin_{ origin }
@@ -69,9 +69,9 @@ void SourcePosition::Reset()
 
 bool SourcePosition::operator < (const SourcePosition& rhs) const
 {
-    if (origin_.get() < rhs.origin_.get())
+    if (origin_ < rhs.origin_)
         return true;
-    else if (origin_.get() > rhs.origin_.get())
+    else if (origin_ > rhs.origin_)
         return false;
 
     if (row_ < rhs.row_)
@@ -21,6 +21,7 @@ namespace Xsc
 Source code origin with filename and line offset.
 This is used to track the filename and correct source position line for each AST within a pre-processed source code.
 This is necessary because the pre-processsor eliminates all include directives.
+The source origins are owned by the source code they belong to (see SourceCode::MakeSourceOrigin).
 */
 struct SourceOrigin
 {
@@ -28,10 +29,14 @@ struct SourceOrigin
     int         lineOffset;
 };
 
-using SourceOriginPtr = std::shared_ptr<SourceOrigin>;
+using SourceOriginPtr = std::unique_ptr<SourceOrigin>;
 
 
-// This class stores the position in a source code file.
+/*
+This class stores the position in a source code file.
+The source origin is only referenced (without reference counting), so copying a source position is cheap,
+but the source code that owns the origin must outlive all source positions that refer to it.
+*/
 class SourcePosition
 {
     
@@ -41,7 +46,7 @@ class SourcePosition
         static const SourcePosition ignore;
 
         SourcePosition() = default;
-        SourcePosition(unsigned int row, unsigned int column, const SourceOriginPtr& origin = nullptr);
+        SourcePosition(unsigned int row, unsigned int column, const SourceOrigin* origin = nullptr);
 
         // Returns the source position as string in the format "Row:Column", e.g. "75:10".
         std::string ToString(bool printFilename = true) const;
@@ -74,7 +79,7 @@ class SourcePosition
         }
 
         // Sets the new source origin.
-        inline void SetOrigin(const SourceOriginPtr& origin)
+        inline void SetOrigin(const SourceOrigin* origin)
         {
             origin_ = origin;
         }
@@ -82,7 +87,7 @@ class SourcePosition
         // Returns the current origin.
         inline const SourceOrigin* GetOrigin() const
         {
-            return origin_.get();
+            return origin_;
         }
 
         // Equivalent to a call to 'IsValid()'.
@@ -93,10 +98,10 @@ class SourcePosition
 
     private:
         
-        unsigned int    row_    = 0,
-                        column_ = 0;
+        unsigned int        row_    = 0,
+                            column_ = 0;
 
-        SourceOriginPtr origin_;
+        const SourceOrigin* origin_ = nullptr;
 
 };
 
@@ -170,6 +170,12 @@ class Token
             return spell_;
         }
 
+        // Sets the source origin of this token (see SourcePosition::SetOrigin).
+        inline void SetOrigin(const SourceOrigin* origin)
+        {
+            pos_.SetOrigin(origin);
+        }
+
     private:
 
         Types           type_;  // Type of this token.
@@ -80,7 +80,7 @@ bool TypeDenoter::IsArray() const
 
 bool TypeDenoter::Equals(const TypeDenoter& rhs, const Flags& /*compareFlags*/) const
 {
-    return (GetAliased().Type() == rhs.GetAliased().Type());
+    return (this == &rhs || GetAliased().Type() == rhs.GetAliased().Type());
 }
 
 bool TypeDenoter::IsCastableTo(const TypeDenoter& targetType) const
@@ -162,7 +162,7 @@ static TypeDenoterPtr FindCommonTypeDenoterScalarAndScalar(BaseTypeDenoter* lhsT
 {
     /* Return scalar type with highest order data type */
     auto commonType = HighestOrderDataType(lhsTypeDen->dataType, rhsTypeDen->dataType);
-    return std::make_shared<BaseTypeDenoter>(commonType);
+    return BaseTypeDenoter::GetCanonical(commonType);
 }
 
 static TypeDenoterPtr FindCommonTypeDenoterScalarAndVector(BaseTypeDenoter* lhsTypeDen, BaseTypeDenoter* rhsTypeDen, bool useMinDimension)
@@ -171,13 +171,13 @@ static TypeDenoterPtr FindCommonTypeDenoterScalarAndVector(BaseTypeDenoter* lhsT
     if (useMinDimension)
     {
         /* Return scalar type (minimal dimension) */
-        return std::make_shared<BaseTypeDenoter>(commonType);
+        return BaseTypeDenoter::GetCanonical(commonType);
     }
     else
     {
         /* Return vector type */
         auto rhsDim = VectorTypeDim(rhsTypeDen->dataType);
-        return std::make_shared<BaseTypeDenoter>(VectorDataType(commonType, rhsDim));
+        return BaseTypeDenoter::GetCanonical(VectorDataType(commonType, rhsDim));
     }
 }
 
@@ -190,7 +190,7 @@ static TypeDenoterPtr FindCommonTypeDenoterVectorAndVector(BaseTypeDenoter* lhsT
     auto rhsDim = VectorTypeDim(rhsTypeDen->dataType);
     auto commonDim = (useMinDimension ? std::min(lhsDim, rhsDim) : std::max(lhsDim, rhsDim));
 
-    return std::make_shared<BaseTypeDenoter>(VectorDataType(commonType, commonDim));
+    return BaseTypeDenoter::GetCanonical(VectorDataType(commonType, commonDim));
 }
 
 static TypeDenoterPtr FindCommonTypeDenoterAnyAndAny(TypeDenoter* lhsTypeDen, TypeDenoter* rhsTypeDen)
@@ -227,12 +227,12 @@ BaseTypeDenoterPtr TypeDenoter::MakeBoolTypeWithDimensionOf(const TypeDenoter& t
     {
         /* Make vector boolean type denoter with dimension of the specified type denoter */
         auto vecBoolType = VectorDataType(DataType::Bool, VectorTypeDim(baseTypeDen->dataType));
-        return std::make_shared<BaseTypeDenoter>(vecBoolType);
+        return BaseTypeDenoter::GetCanonical(vecBoolType);
     }
     else
     {
         /* Make single boolean type denoter */
-        return std::make_shared<BaseTypeDenoter>(DataType::Bool);
+        return BaseTypeDenoter::GetCanonical(DataType::Bool);
     }
 }
 
@@ -271,6 +271,12 @@ TypeDenoterPtr VoidTypeDenoter::Copy() const
     return std::make_shared<VoidTypeDenoter>();
 }
 
+const VoidTypeDenoterPtr& VoidTypeDenoter::GetCanonical()
+{
+    static const VoidTypeDenoterPtr canonicalTypeDen = std::make_shared<VoidTypeDenoter>();
+    return canonicalTypeDen;
+}
+
 bool VoidTypeDenoter::IsCastableTo(const TypeDenoter& targetType) const
 {
     /* Void can not be casted to anything */
@@ -315,6 +321,26 @@ BaseTypeDenoter::BaseTypeDenoter(DataType dataType) :
 {
 }
 
+static std::vector<BaseTypeDenoterPtr> GenerateCanonicalBaseTypeDenoters()
+{
+    const auto numDataTypes = static_cast<std::size_t>(DataType::Double4x4) + 1u;
+
+    std::vector<BaseTypeDenoterPtr> typeDens(numDataTypes);
+    for (std::size_t i = 0; i < numDataTypes; ++i)
+        typeDens[i] = std::make_shared<BaseTypeDenoter>(static_cast<DataType>(i));
+
+    return typeDens;
+}
+
+const BaseTypeDenoterPtr& BaseTypeDenoter::GetCanonical(const DataType dataType)
+{
+    /* Initialized with the first call (thread-safe), and never modified afterwards */
+    static const auto canonicalTypeDens = GenerateCanonicalBaseTypeDenoters();
+
+    const auto idx = static_cast<std::size_t>(dataType);
+    return canonicalTypeDens[idx < canonicalTypeDens.size() ? idx : 0];
+}
+
 std::string BaseTypeDenoter::ToString() const
 {
     return DataTypeToString(dataType);
@@ -342,6 +368,10 @@ bool BaseTypeDenoter::IsMatrix() const
 
 bool BaseTypeDenoter::Equals(const TypeDenoter& rhs, const Flags& /*compareFlags*/) const
 {
+    /* Canonical type denoters are pointer-equal */
+    if (this == &rhs)
+        return true;
+
     /* Compare data types of both type denoters */
     if (auto rhsBaseTypeDen = rhs.As<BaseTypeDenoter>())
         return (dataType == rhsBaseTypeDen->dataType);
@@ -385,7 +415,7 @@ TypeDenoterPtr BaseTypeDenoter::GetSubObject(const std::string& ident, const AST
     try
     {
         auto subscriptDataType = SubscriptDataType(dataType, ident);
-        return std::make_shared<BaseTypeDenoter>(subscriptDataType);
+        return BaseTypeDenoter::GetCanonical(subscriptDataType);
     }
     catch (const std::exception& e)
     {
@@ -404,7 +434,7 @@ TypeDenoterPtr BaseTypeDenoter::GetSubArray(const std::size_t numArrayIndices, c
             if (numArrayIndices > 1)
                 RuntimeErr(R_TooManyArrayDimensions(R_VectorTypeDen), ast);
             else
-                return std::make_shared<BaseTypeDenoter>(BaseDataType(dataType));
+                return BaseTypeDenoter::GetCanonical(BaseDataType(dataType));
         }
         else if (IsMatrixType(dataType))
         {
@@ -412,10 +442,10 @@ TypeDenoterPtr BaseTypeDenoter::GetSubArray(const std::size_t numArrayIndices, c
             if (numArrayIndices == 1)
             {
                 auto matrixDim = MatrixTypeDim(dataType);
-                return std::make_shared<BaseTypeDenoter>(VectorDataType(BaseDataType(dataType), matrixDim.second));
+                return BaseTypeDenoter::GetCanonical(VectorDataType(BaseDataType(dataType), matrixDim.second));
             }
             else if (numArrayIndices == 2)
-                return std::make_shared<BaseTypeDenoter>(BaseDataType(dataType));
+                return BaseTypeDenoter::GetCanonical(BaseDataType(dataType));
             else if (numArrayIndices > 2)
                 RuntimeErr(R_TooManyArrayDimensions(R_MatrixTypeDen), ast);
         }
@@ -519,7 +549,7 @@ TypeDenoterPtr BufferTypeDenoter::GetSubArray(const std::size_t numArrayIndices,
 
 TypeDenoterPtr BufferTypeDenoter::GetGenericTypeDenoter() const
 {
-    return (genericTypeDenoter ? genericTypeDenoter : std::make_shared<BaseTypeDenoter>(DataType::Float4));
+    return (genericTypeDenoter ? genericTypeDenoter : BaseTypeDenoter::GetCanonical(DataType::Float4));
 }
 
 AST* BufferTypeDenoter::SymbolRef() const
@@ -618,6 +648,9 @@ void StructTypeDenoter::SetIdentIfAnonymous(const std::string& ident)
 
 bool StructTypeDenoter::Equals(const TypeDenoter& rhs, const Flags& compareFlags) const
 {
+    if (this == &rhs)
+        return true;
+
     if (auto rhsStructTypeDen = rhs.GetAliased().As<StructTypeDenoter>())
     {
         /* Get structure declarations from type denoters */
@@ -163,6 +163,9 @@ struct VoidTypeDenoter : public TypeDenoter
 {
     static const Types classType = Types::Void;
 
+    // Returns the shared canonical void type denoter, which must not be modified.
+    static const VoidTypeDenoterPtr& GetCanonical();
+
     Types Type() const override;
     std::string ToString() const override;
     TypeDenoterPtr Copy() const override;
@@ -191,6 +194,12 @@ struct BaseTypeDenoter : public TypeDenoter
     BaseTypeDenoter() = default;
     BaseTypeDenoter(DataType dataType);
 
+    /*
+    Returns the shared canonical base type denoter of the specified data type, which must not be modified.
+    Use this for derived types (e.g. of expressions), so that equal base types are pointer-equal and need no allocation.
+    */
+    static const BaseTypeDenoterPtr& GetCanonical(const DataType dataType);
+
     Types Type() const override;
     std::string ToString() const override;
     TypeDenoterPtr Copy() const override;
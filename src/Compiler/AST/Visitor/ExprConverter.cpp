@@ -36,7 +36,7 @@ static void ConvertCastExpr(ExprPtr& expr, const DataType sourceType, const Data
 
         if (sourceDim < targetDim)
         {
-            auto typeDenoter = std::make_shared<BaseTypeDenoter>(targetType);
+            auto typeDenoter = BaseTypeDenoter::GetCanonical(targetType);
 
             std::vector<ExprPtr> args;
             args.push_back(expr);
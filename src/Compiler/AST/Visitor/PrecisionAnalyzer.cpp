@@ -0,0 +1,408 @@
+/*
+ * PrecisionAnalyzer.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "PrecisionAnalyzer.h"
+#include "AST.h"
+#include <algorithm>
+#include <cctype>
+
+
+namespace Xsc
+{
+
+
+void PrecisionAnalyzer::MarkPrecisionQualifiers(Program& program, const PrecisionInference inference)
+{
+    if (inference == PrecisionInference::Disabled)
+        return;
+
+    inference_ = inference;
+
+    /* Collect data flow of all reachable functions */
+    Visit(&program);
+
+    /* Propagate precisions through the data flow */
+    if (inference_ == PrecisionInference::Aggressive)
+        PropagateMediumPrecision();
+
+    PropagateHighPrecision();
+
+    /* Write final precisions into the type specifiers */
+    for (auto varDeclStmnt : varDeclStmnts_)
+        MarkVarDeclStmnt(*varDeclStmnt);
+
+    for (auto funcDecl : funcDecls_)
+        MarkFunctionDecl(*funcDecl);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+PrecisionAnalyzer::Precision PrecisionAnalyzer::GetDeclaredPrecision(const TypeDenoter& typeDenoter) const
+{
+    /* Get base type of (multi-dimensional) arrays */
+    const auto* typeDen = &(typeDenoter.GetAliased());
+
+    while (auto arrayTypeDen = typeDen->As<ArrayTypeDenoter>())
+        typeDen = &(arrayTypeDen->subTypeDenoter->GetAliased());
+
+    if (auto baseTypeDen = typeDen->As<BaseTypeDenoter>())
+    {
+        if (IsHalfRealType(baseTypeDen->dataType))
+            return Precision::Medium;
+        if (IsRealType(baseTypeDen->dataType))
+            return Precision::High;
+    }
+
+    return Precision::Undefined;
+}
+
+bool PrecisionAnalyzer::IsInferableVarDecl(const VarDecl* varDecl) const
+{
+    /* Only local variables inside a function body can be lowered, since their values are not visible to the outside */
+    return
+    (
+        InsideFunctionDecl()                                                &&
+        !varDecl->IsParameter()                                             &&
+        !varDecl->IsStatic()                                                &&
+        !varDecl->flags(VarDecl::isShaderInput | VarDecl::isShaderOutput)   &&
+        varDecl->structDeclRef == nullptr                                   &&
+        varDecl->bufferDeclRef == nullptr
+    );
+}
+
+void PrecisionAnalyzer::AddSource(const AST* source)
+{
+    if (!destStack_.empty() && destStack_.back() != nullptr && destStack_.back() != source)
+        nodes_[destStack_.back()].sources.insert(source);
+}
+
+void PrecisionAnalyzer::VisitWithDest(const AST* dest, AST* ast)
+{
+    destStack_.push_back(dest);
+    {
+        Visit(ast);
+    }
+    destStack_.pop_back();
+}
+
+bool PrecisionAnalyzer::IsTextureSampleIntrinsic(const Intrinsic intrinsic) const
+{
+    return (IsTextureIntrinsic(intrinsic) || (intrinsic >= Intrinsic::Tex1D_2 && intrinsic <= Intrinsic::TexCubeProj));
+}
+
+bool PrecisionAnalyzer::IsHighPrecisionSemantic(const IndexedSemantic& semantic) const
+{
+    if (semantic == Semantic::VertexPosition)
+        return true;
+
+    if (semantic.IsUserDefined())
+    {
+        /* User defined semantics are case insensitive */
+        auto name = semantic.UserDefinedName();
+        std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+        return (name == "TEXCOORD");
+    }
+
+    return false;
+}
+
+void PrecisionAnalyzer::PropagateMediumPrecision()
+{
+    /* Lower inferable variables to 'mediump' until a fixpoint is reached */
+    for (bool changed = true; changed;)
+    {
+        changed = false;
+
+        for (auto& it : nodes_)
+        {
+            auto& node = it.second;
+            if (!node.isInferable || node.precision == Precision::High)
+                continue;
+
+            /* Determine highest precision of all real-typed sources (undecided sources are ignored) */
+            auto precision = Precision::Undefined;
+
+            for (auto source : node.sources)
+            {
+                auto sourceIt = nodes_.find(source);
+                if (sourceIt != nodes_.end())
+                {
+                    const auto sourcePrecision = sourceIt->second.precision;
+                    if (sourcePrecision == Precision::High)
+                        precision = Precision::High;
+                    else if (sourcePrecision == Precision::Medium && precision == Precision::Undefined)
+                        precision = Precision::Medium;
+                }
+            }
+
+            if (precision != Precision::Undefined && precision != node.precision)
+            {
+                node.precision = precision;
+                changed = true;
+            }
+        }
+    }
+}
+
+void PrecisionAnalyzer::PropagateHighPrecision()
+{
+    /* Mark all transitive sources of the sinks as 'highp' */
+    std::vector<const AST*> worklist;
+
+    for (const auto& it : nodes_)
+    {
+        if (it.second.isHighRequired)
+            worklist.push_back(it.first);
+    }
+
+    while (!worklist.empty())
+    {
+        auto ast = worklist.back();
+        worklist.pop_back();
+
+        for (auto source : nodes_[ast].sources)
+        {
+            auto& sourceNode = nodes_[source];
+            if (!sourceNode.isHighRequired)
+            {
+                sourceNode.isHighRequired = true;
+                worklist.push_back(source);
+            }
+        }
+    }
+}
+
+PrecisionAnalyzer::Precision PrecisionAnalyzer::GetFinalPrecision(const AST* ast) const
+{
+    auto it = nodes_.find(ast);
+    if (it != nodes_.end())
+    {
+        const auto& node = it->second;
+
+        if (node.precision == Precision::Undefined)
+        {
+            /* Inferable variables without any half-precision source keep their declared precision */
+            return (node.isInferable ? Precision::High : Precision::Undefined);
+        }
+
+        return (node.isHighRequired ? Precision::High : node.precision);
+    }
+    return Precision::Undefined;
+}
+
+void PrecisionAnalyzer::MarkTypeSpecifier(TypeSpecifier& typeSpecifier, const Precision precision)
+{
+    if (precision == Precision::Medium)
+        typeSpecifier.flags << TypeSpecifier::isMediumPrecision;
+    else if (precision == Precision::High)
+        typeSpecifier.flags << TypeSpecifier::isHighPrecision;
+}
+
+void PrecisionAnalyzer::MarkVarDeclStmnt(VarDeclStmnt& varDeclStmnt)
+{
+    /* All variables of a declaration statement share the same type specifier, so use the highest precision */
+    auto precision = Precision::Undefined;
+
+    for (const auto& varDecl : varDeclStmnt.varDecls)
+    {
+        auto varPrecision = GetFinalPrecision(varDecl.get());
+        if (varPrecision == Precision::High)
+            precision = Precision::High;
+        else if (varPrecision == Precision::Medium && precision == Precision::Undefined)
+            precision = Precision::Medium;
+    }
+
+    MarkTypeSpecifier(*varDeclStmnt.typeSpecifier, precision);
+}
+
+void PrecisionAnalyzer::MarkFunctionDecl(FunctionDecl& funcDecl)
+{
+    if (auto funcImpl = funcDecl.funcImplRef)
+    {
+        /* Copy precisions from function implementation into forward declaration */
+        MarkTypeSpecifier(*funcDecl.returnType, GetFinalPrecision(funcImpl));
+
+        for (std::size_t i = 0, n = std::min(funcDecl.parameters.size(), funcImpl->parameters.size()); i < n; ++i)
+        {
+            const auto& paramImpl = funcImpl->parameters[i];
+            if (!paramImpl->varDecls.empty())
+                MarkTypeSpecifier(*funcDecl.parameters[i]->typeSpecifier, GetFinalPrecision(paramImpl->varDecls.front().get()));
+        }
+    }
+    else
+        MarkTypeSpecifier(*funcDecl.returnType, GetFinalPrecision(&funcDecl));
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void PrecisionAnalyzer::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(VarDecl)
+{
+    /* Register variable node with its declared precision */
+    auto& node = nodes_[ast];
+
+    node.precision = GetDeclaredPrecision(*ast->GetTypeDenoter());
+
+    if (inference_ == PrecisionInference::Aggressive && node.precision == Precision::High && IsInferableVarDecl(ast))
+    {
+        node.precision      = Precision::Undefined;
+        node.isInferable    = true;
+    }
+
+    /* Vertex position and texture coordinates (also as structure members) must always be passed with full precision */
+    if (IsHighPrecisionSemantic(ast->semantic))
+        node.isHighRequired = true;
+
+    VisitWithDest(ast, ast->initializer.get());
+}
+
+IMPLEMENT_VISIT_PROC(FunctionDecl)
+{
+    if (!ast->flags(AST::isReachable))
+        return;
+
+    if (ast->IsForwardDecl())
+    {
+        /* Forward declarations take the precisions of their implementation */
+        if (ast->funcImplRef)
+            funcDecls_.push_back(ast);
+        return;
+    }
+
+    /* Register function return value node */
+    auto& node = nodes_[ast];
+
+    node.precision = GetDeclaredPrecision(*ast->returnType->GetTypeDenoter());
+
+    if (ast->flags(FunctionDecl::isEntryPoint | FunctionDecl::isSecondaryEntryPoint) && IsHighPrecisionSemantic(ast->semantic))
+        node.isHighRequired = true;
+
+    funcDecls_.push_back(ast);
+
+    PushFunctionDecl(ast);
+    {
+        destStack_.push_back(nullptr);
+        {
+            Visit(ast->parameters);
+            Visit(ast->codeBlock);
+        }
+        destStack_.pop_back();
+    }
+    PopFunctionDecl();
+}
+
+IMPLEMENT_VISIT_PROC(VarDeclStmnt)
+{
+    varDeclStmnts_.push_back(ast);
+    Visit(ast->typeSpecifier);
+    Visit(ast->varDecls);
+}
+
+IMPLEMENT_VISIT_PROC(ReturnStmnt)
+{
+    VisitWithDest(ActiveFunctionDecl(), ast->expr.get());
+}
+
+IMPLEMENT_VISIT_PROC(TernaryExpr)
+{
+    /* Condition does not contribute to the value of the expression */
+    VisitWithDest(nullptr, ast->condExpr.get());
+    Visit(ast->thenExpr);
+    Visit(ast->elseExpr);
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    Visit(ast->prefixExpr);
+
+    if (auto funcDecl = ast->GetFunctionImpl())
+    {
+        /* Return value of the function flows into the active destination */
+        AddSource(funcDecl);
+
+        /* Arguments flow into the parameters, and output parameters flow back into the arguments */
+        for (std::size_t i = 0, n = std::min(ast->arguments.size(), funcDecl->parameters.size()); i < n; ++i)
+        {
+            auto param  = funcDecl->parameters[i].get();
+            auto arg    = ast->arguments[i].get();
+
+            if (param->varDecls.empty())
+                continue;
+
+            auto paramVar = param->varDecls.front().get();
+
+            if (param->IsInput())
+                VisitWithDest(paramVar, arg);
+            else
+                VisitWithDest(nullptr, arg);
+
+            if (param->IsOutput())
+            {
+                if (auto lvalueExpr = arg->FetchLValueExpr())
+                {
+                    if (auto varDecl = lvalueExpr->FetchVarDecl())
+                        nodes_[varDecl].sources.insert(paramVar);
+                }
+            }
+        }
+    }
+    else if (IsTextureSampleIntrinsic(ast->intrinsic))
+    {
+        /* Texture coordinates are a sink that requires full precision */
+        nodes_[ast].isHighRequired = true;
+        for (auto& arg : ast->arguments)
+            VisitWithDest(ast, arg.get());
+    }
+    else
+        Visit(ast->arguments);
+}
+
+IMPLEMENT_VISIT_PROC(AssignExpr)
+{
+    if (auto lvalueExpr = ast->lvalueExpr->FetchLValueExpr())
+    {
+        if (auto varDecl = lvalueExpr->FetchVarDecl())
+        {
+            /* R-value flows into the variable of the l-value */
+            VisitWithDest(varDecl, ast->rvalueExpr.get());
+            VisitWithDest(nullptr, ast->lvalueExpr.get());
+            return;
+        }
+    }
+
+    Visit(ast->rvalueExpr);
+    VisitWithDest(nullptr, ast->lvalueExpr.get());
+}
+
+IMPLEMENT_VISIT_PROC(ObjectExpr)
+{
+    if (auto varDecl = ast->FetchVarDecl())
+        AddSource(varDecl);
+    Visit(ast->prefixExpr);
+}
+
+IMPLEMENT_VISIT_PROC(ArrayExpr)
+{
+    /* Array indices do not contribute to the value of the expression */
+    Visit(ast->prefixExpr);
+    for (auto& index : ast->arrayIndices)
+        VisitWithDest(nullptr, index.get());
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
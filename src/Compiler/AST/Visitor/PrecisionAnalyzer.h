@@ -0,0 +1,125 @@
+/*
+ * PrecisionAnalyzer.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_PRECISION_ANALYZER_H
+#define XSC_PRECISION_ANALYZER_H
+
+
+#include "Visitor.h"
+#include "ASTEnums.h"
+#include <Xsc/Xsc.h>
+#include <map>
+#include <set>
+#include <vector>
+
+
+namespace Xsc
+{
+
+
+struct TypeDenoter;
+
+/*
+Precision qualifier analyzer.
+This is a helper class for the GLSL generator to infer the 'mediump' and 'highp' precision qualifiers for ESSL output.
+The precision of all variables is propagated through the data flow of all reachable functions,
+and all values that feed the vertex position or texture coordinates (of texture sample functions or 'TEXCOORD' semantics) are forced to 'highp'.
+*/
+class PrecisionAnalyzer : private Visitor
+{
+
+    public:
+
+        // Marks the type specifiers of all reachable declarations with the inferred precision (see TypeSpecifier::isMediumPrecision).
+        void MarkPrecisionQualifiers(Program& program, const PrecisionInference inference);
+
+    private:
+
+        enum class Precision
+        {
+            Undefined,
+            Medium,
+            High,
+        };
+
+        // Data flow node for a variable, a function return value, or a sink (e.g. texture coordinates).
+        struct Node
+        {
+            Precision               precision       = Precision::Undefined; // Declared (or inferred) precision.
+            bool                    isInferable     = false;                // Precision can be lowered to 'mediump' (only for aggressive inference).
+            bool                    isHighRequired  = false;                // Precision must be 'highp'.
+            std::set<const AST*>    sources;                                // Nodes whose values flow into this node.
+        };
+
+        // Returns the precision that is declared by the specified type denoter.
+        Precision GetDeclaredPrecision(const TypeDenoter& typeDenoter) const;
+
+        // Returns true if the precision of the specified local variable can be lowered.
+        bool IsInferableVarDecl(const VarDecl* varDecl) const;
+
+        // Adds an edge from the specified source node to the active destination node.
+        void AddSource(const AST* source);
+
+        // Visits the specified expression with the specified destination node.
+        void VisitWithDest(const AST* dest, AST* ast);
+
+        // Returns true if the specified intrinsic samples a texture with coordinates.
+        bool IsTextureSampleIntrinsic(const Intrinsic intrinsic) const;
+
+        // Returns true if the specified semantic must be passed between shader stages with full precision (i.e. vertex position and texture coordinates).
+        bool IsHighPrecisionSemantic(const IndexedSemantic& semantic) const;
+
+        // Propagates 'mediump' forwards through all inferable variables.
+        void PropagateMediumPrecision();
+
+        // Propagates 'highp' backwards from all sinks.
+        void PropagateHighPrecision();
+
+        // Returns the final precision of the specified node.
+        Precision GetFinalPrecision(const AST* ast) const;
+
+        // Writes the final precision into the flags of the specified type specifier.
+        void MarkTypeSpecifier(TypeSpecifier& typeSpecifier, const Precision precision);
+
+        void MarkVarDeclStmnt(VarDeclStmnt& varDeclStmnt);
+        void MarkFunctionDecl(FunctionDecl& funcDecl);
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( VarDecl      );
+        DECL_VISIT_PROC( FunctionDecl );
+
+        DECL_VISIT_PROC( VarDeclStmnt );
+        DECL_VISIT_PROC( ReturnStmnt  );
+
+        DECL_VISIT_PROC( TernaryExpr  );
+        DECL_VISIT_PROC( CallExpr     );
+        DECL_VISIT_PROC( AssignExpr   );
+        DECL_VISIT_PROC( ObjectExpr   );
+        DECL_VISIT_PROC( ArrayExpr    );
+
+        /* === Members === */
+
+        PrecisionInference          inference_      = PrecisionInference::Disabled;
+
+        std::map<const AST*, Node>  nodes_;
+        std::vector<const AST*>     destStack_;
+
+        std::vector<VarDeclStmnt*>  varDeclStmnts_;
+        std::vector<FunctionDecl*>  funcDecls_;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,6 +7,7 @@
 
 #include "ReflectionAnalyzer.h"
 #include "ConstExprEvaluator.h"
+#include "GLSLMemoryLayout.h"
 #include "AST.h"
 #include "Helper.h"
 #include "ReportIdents.h"
@@ -22,10 +23,12 @@ ReflectionAnalyzer::ReflectionAnalyzer(Log* log) :
 }
 
 void ReflectionAnalyzer::Reflect(
-    Program& program, const ShaderTarget shaderTarget, Reflection::ReflectionData& reflectionData, bool enableWarnings)
+    Program& program, const ShaderTarget shaderTarget, const OutputShaderVersion shaderVersion,
+    Reflection::ReflectionData& reflectionData, bool enableWarnings)
 {
     /* Copy parameters */
     shaderTarget_   = shaderTarget;
+    shaderVersion_  = shaderVersion;
     program_        = (&program);
     data_           = (&reflectionData);
     enableWarnings_ = enableWarnings;
@@ -114,6 +117,16 @@ IMPLEMENT_VISIT_PROC(Program)
 
 /* --- Declarations --- */
 
+IMPLEMENT_VISIT_PROC(VarDecl)
+{
+    if (ast->flags(AST::isReachable) && ast->specConstantId >= 0 && IsLanguageVKSL(shaderVersion_))
+    {
+        /* Reflect specialization constant ID (only VKSL supports specialization constants) */
+        data_->specConstants.push_back({ ast->ident, ast->specConstantId });
+    }
+    VISIT_DEFAULT(VarDecl);
+}
+
 IMPLEMENT_VISIT_PROC(SamplerDecl)
 {
     /* Reflect sampler state */
@@ -139,8 +152,28 @@ IMPLEMENT_VISIT_PROC(UniformBufferDecl)
 {
     if (ast->flags(AST::isReachable))
     {
-        /* Reflect constant buffer binding */
-        data_->constantBuffers.push_back({ ast->ident, GetBindingPoint(ast->slotRegisters) });
+        if (ast->flags(UniformBufferDecl::isPushConstant))
+        {
+            /* Reflect push constant block layout */
+            ReflectUniformBufferLayout(ast, data_->pushConstants);
+        }
+        else
+        {
+            /* Reflect constant buffer binding */
+            data_->constantBuffers.push_back({ ast->ident, GetBindingPoint(ast->slotRegisters) });
+
+            /*
+            Reflect uniform block layout (constant buffers are written as individual uniforms before GLSL 1.40 and for ESSL 1.00),
+            or the layout of the packed 'vec4' array
+            */
+            if ( ( shaderVersion_ >= OutputShaderVersion::GLSL140 && shaderVersion_ != OutputShaderVersion::ESSL100 ) ||
+                 ast->flags(UniformBufferDecl::isPackedUniforms) )
+            {
+                Reflection::BufferLayout bufferLayout;
+                ReflectUniformBufferLayout(ast, bufferLayout);
+                data_->bufferLayouts.push_back(bufferLayout);
+            }
+        }
     }
 }
 
@@ -162,7 +195,10 @@ IMPLEMENT_VISIT_PROC(BufferDeclStmnt)
                 if (!IsStorageBufferType(ast->typeDenoter->bufferType))
                     data_->textures.push_back(bindingSlot);
                 else
+                {
                     data_->storageBuffers.push_back(bindingSlot);
+                    ReflectStorageBufferLayout(bufferDecl.get());
+                }
             }
         }
     }
@@ -282,6 +318,62 @@ void ReflectionAnalyzer::ReflectSamplerValueComparisonFunc(const std::string& va
     }
 }
 
+static Reflection::BufferField MakeBufferField(const std::string& ident, const std::string& type, unsigned int offset, const GLSLTypeLayout& typeLayout)
+{
+    Reflection::BufferField field;
+    {
+        field.ident         = ident;
+        field.type          = type;
+        field.offset        = offset;
+        field.size          = typeLayout.size;
+        field.arrayStride   = typeLayout.arrayStride;
+        field.matrixStride  = typeLayout.matrixStride;
+    }
+    return field;
+}
+
+void ReflectionAnalyzer::ReflectUniformBufferLayout(UniformBufferDecl* ast, Reflection::BufferLayout& bufferLayout)
+{
+    /* Push constant blocks use the 'std430' layout rules, packed 'vec4' arrays use the HLSL packing rules, all other uniform blocks use 'std140' */
+    auto memoryLayout = GLSLMemoryLayout::Std140;
+
+    if (ast->flags(UniformBufferDecl::isPushConstant))
+        memoryLayout = GLSLMemoryLayout::Std430;
+    else if (ast->flags(UniformBufferDecl::isPackedUniforms))
+        memoryLayout = GLSLMemoryLayout::Packed;
+
+    /* ESSL does not support explicit member offsets, so 'packoffset' is ignored in the output (except for packed 'vec4' arrays) */
+    const bool usePackOffsets = (!IsLanguageESSL(shaderVersion_) || memoryLayout == GLSLMemoryLayout::Packed);
+
+    std::vector<GLSLMemberLayout> memberLayouts;
+    bufferLayout.ident  = ast->ident;
+    bufferLayout.size   = GetGLSLBlockLayout(ast->varMembers, memoryLayout, &memberLayouts, usePackOffsets).size;
+
+    for (const auto& member : memberLayouts)
+    {
+        bufferLayout.fields.push_back(
+            MakeBufferField(member.varDecl->ident, member.varDecl->GetTypeDenoter()->ToString(), member.offset, member.typeLayout)
+        );
+    }
+}
+
+void ReflectionAnalyzer::ReflectStorageBufferLayout(BufferDecl* ast)
+{
+    if (auto genericTypeDen = ast->declStmntRef->typeDenoter->GetGenericTypeDenoter())
+    {
+        /* Storage buffers are written as a single array of variable size with the 'std430' layout rules */
+        const auto typeLayout = GetGLSLRuntimeArrayLayout(*genericTypeDen, GLSLMemoryLayout::Std430);
+
+        Reflection::BufferLayout bufferLayout;
+        {
+            bufferLayout.ident  = ast->ident;
+            bufferLayout.size   = typeLayout.size;
+            bufferLayout.fields.push_back(MakeBufferField(ast->ident, genericTypeDen->ToString() + "[]", 0, typeLayout));
+        }
+        data_->bufferLayouts.push_back(bufferLayout);
+    }
+}
+
 void ReflectionAnalyzer::ReflectAttributes(const std::vector<AttributePtr>& attribs)
 {
     for (const auto& attr : attribs)
@@ -36,6 +36,7 @@ class ReflectionAnalyzer : private Visitor
         void Reflect(
             Program& program,
             const ShaderTarget shaderTarget,
+            const OutputShaderVersion shaderVersion,
             Reflection::ReflectionData& reflectionData,
             bool enableWarnings
         );
@@ -54,6 +55,7 @@ class ReflectionAnalyzer : private Visitor
 
         DECL_VISIT_PROC( Program           );
 
+        DECL_VISIT_PROC( VarDecl           );
         DECL_VISIT_PROC( SamplerDecl       );
 
         DECL_VISIT_PROC( FunctionDecl      );
@@ -67,6 +69,9 @@ class ReflectionAnalyzer : private Visitor
         void ReflectSamplerValueTextureAddressMode(const std::string& value, Reflection::TextureAddressMode& addressMode, const AST* ast = nullptr);
         void ReflectSamplerValueComparisonFunc(const std::string& value, Reflection::ComparisonFunc& comparisonFunc, const AST* ast = nullptr);
 
+        void ReflectUniformBufferLayout(UniformBufferDecl* ast, Reflection::BufferLayout& bufferLayout);
+        void ReflectStorageBufferLayout(BufferDecl* ast);
+
         void ReflectAttributes(const std::vector<AttributePtr>& attribs);
         void ReflectAttributesNumThreads(Attribute* ast);
 
@@ -75,6 +80,7 @@ class ReflectionAnalyzer : private Visitor
         ReportHandler               reportHandler_;
 
         ShaderTarget                shaderTarget_   = ShaderTarget::VertexShader;
+        OutputShaderVersion         shaderVersion_  = OutputShaderVersion::GLSL;
         Program*                    program_        = nullptr;
 
         Reflection::ReflectionData* data_           = nullptr;
@@ -0,0 +1,128 @@
+/*
+ * UniformPackingAnalyzer.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "UniformPackingAnalyzer.h"
+#include "AST.h"
+
+
+namespace Xsc
+{
+
+
+void UniformPackingAnalyzer::MarkPackedUniformBuffers(Program& program, RejectionMap& rejectedBuffers)
+{
+    rejectedBuffers_ = (&rejectedBuffers);
+
+    /* Mark all reachable constant buffers with packable member types */
+    for (auto& stmnt : program.globalStmnts)
+    {
+        if (auto uniformBufferDecl = AST::GetAs<UniformBufferDecl>(stmnt.get()))
+        {
+            if (uniformBufferDecl->bufferType == UniformBufferType::ConstantBuffer && uniformBufferDecl->flags(AST::isReachable))
+            {
+                if (auto varDecl = FindUnpackableMember(*uniformBufferDecl))
+                    rejectedBuffers.insert({ uniformBufferDecl, varDecl });
+                else
+                    uniformBufferDecl->flags << UniformBufferDecl::isPackedUniforms;
+            }
+        }
+    }
+
+    /* Reject all constant buffers whose array members are not only accessed by an array index */
+    Visit(&program);
+
+    for (const auto& it : rejectedBuffers)
+        it.first->flags.Remove(UniformBufferDecl::isPackedUniforms);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+static bool IsPackableBaseType(const TypeDenoter& typeDenoter, bool allowMatrix)
+{
+    if (auto baseTypeDen = typeDenoter.GetAliased().As<BaseTypeDenoter>())
+    {
+        const auto dataType = baseTypeDen->dataType;
+        return (IsRealType(dataType) && !IsDoubleRealType(dataType) && (allowMatrix || !IsMatrixType(dataType)));
+    }
+    return false;
+}
+
+static bool IsPackableType(const TypeDenoter& typeDenoter)
+{
+    const auto& typeDen = typeDenoter.GetAliased();
+
+    if (auto arrayTypeDen = typeDen.As<ArrayTypeDenoter>())
+        return (arrayTypeDen->arrayDims.size() == 1 && IsPackableBaseType(*arrayTypeDen->subTypeDenoter, false));
+    else
+        return IsPackableBaseType(typeDen, true);
+}
+
+VarDecl* UniformPackingAnalyzer::FindUnpackableMember(UniformBufferDecl& uniformBufferDecl) const
+{
+    for (auto& varDeclStmnt : uniformBufferDecl.varMembers)
+    {
+        /* Static members are not part of the buffer */
+        if (varDeclStmnt->typeSpecifier->HasAnyStorageClassesOf({ StorageClass::Static }))
+            continue;
+
+        for (auto& varDecl : varDeclStmnt->varDecls)
+        {
+            if (!IsPackableType(*varDecl->GetTypeDenoter()))
+                return varDecl.get();
+        }
+    }
+    return nullptr;
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void UniformPackingAnalyzer::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(FunctionDecl)
+{
+    /* Only reachable functions are written to the output */
+    if (ast->flags(AST::isReachable))
+        VISIT_DEFAULT(FunctionDecl);
+}
+
+IMPLEMENT_VISIT_PROC(ObjectExpr)
+{
+    if (auto varDecl = ast->FetchVarDecl())
+    {
+        if (auto uniformBufferDecl = varDecl->bufferDeclRef)
+        {
+            /* Array members must be accessed by an array index, since the packed array can not be passed as a whole */
+            if (uniformBufferDecl->flags(UniformBufferDecl::isPackedUniforms) &&
+                varDecl->GetTypeDenoter()->GetAliased().IsArray() &&
+                indexedObjectExprs_.find(ast) == indexedObjectExprs_.end())
+            {
+                rejectedBuffers_->insert({ uniformBufferDecl, varDecl });
+            }
+        }
+    }
+    VISIT_DEFAULT(ObjectExpr);
+}
+
+IMPLEMENT_VISIT_PROC(ArrayExpr)
+{
+    if (auto objectExpr = AST::GetAs<ObjectExpr>(ast->prefixExpr.get()))
+        indexedObjectExprs_.insert(objectExpr);
+    VISIT_DEFAULT(ArrayExpr);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
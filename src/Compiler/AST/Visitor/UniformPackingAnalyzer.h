@@ -0,0 +1,68 @@
+/*
+ * UniformPackingAnalyzer.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_UNIFORM_PACKING_ANALYZER_H
+#define XSC_UNIFORM_PACKING_ANALYZER_H
+
+
+#include "Visitor.h"
+#include <map>
+#include <set>
+
+
+namespace Xsc
+{
+
+
+/*
+Uniform packing analyzer.
+This is a helper class for the GLSL generator to select the constant buffers that can be packed into a single 'vec4' array.
+A constant buffer can only be packed if all members are single-precision floating-point scalars, vectors, or matrices (or one-dimensional arrays of scalars and vectors),
+and if all array members are only accessed by an array index.
+*/
+class UniformPackingAnalyzer : private Visitor
+{
+
+    public:
+
+        // Map of rejected constant buffers to the member variable that prevents the buffer from being packed.
+        using RejectionMap = std::map<UniformBufferDecl*, VarDecl*>;
+
+        /*
+        Marks all reachable constant buffers that can be packed (see UniformBufferDecl::isPackedUniforms).
+        All constant buffers that can not be packed are returned in the output parameter 'rejectedBuffers'.
+        */
+        void MarkPackedUniformBuffers(Program& program, RejectionMap& rejectedBuffers);
+
+    private:
+
+        // Returns the first member variable of the specified constant buffer that can not be packed, or null if all members can be packed.
+        VarDecl* FindUnpackableMember(UniformBufferDecl& uniformBufferDecl) const;
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( FunctionDecl );
+
+        DECL_VISIT_PROC( ObjectExpr   );
+        DECL_VISIT_PROC( ArrayExpr    );
+
+        /* === Members === */
+
+        RejectionMap*                   rejectedBuffers_    = nullptr;
+        std::set<const ObjectExpr*>     indexedObjectExprs_;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
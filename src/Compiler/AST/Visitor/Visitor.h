@@ -9,6 +9,7 @@
 #define XSC_VISITOR_H
 
 
+#include "SparseValue.h"
 #include <memory>
 #include <vector>
 #include <stack>
@@ -168,6 +169,12 @@ class Visitor
                 Visit(ast, args);
         }
 
+        template <typename T>
+        void Visit(const SparseValue<std::vector<T>>& astList, void* args = nullptr)
+        {
+            Visit(astList.Get(), args);
+        }
+
         /* ----- Function declaration tracker ----- */
 
         void PushFunctionDecl(FunctionDecl* ast);
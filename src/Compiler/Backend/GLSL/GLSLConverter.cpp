@@ -256,6 +256,7 @@ IMPLEMENT_VISIT_PROC(StructDecl)
 
         ast->localStmnts.insert(ast->localStmnts.begin(), baseMember);
         ast->varMembers.insert(ast->varMembers.begin(), baseMember);
+        ast->InvalidateMemberIndex();
     }
 
     PushStructDecl(ast);
@@ -276,6 +277,8 @@ IMPLEMENT_VISIT_PROC(StructDecl)
         auto dummyMember = ASTFactory::MakeVarDeclStmnt(DataType::Int, GetNameMangling().temporaryPrefix + g_stdNameDummy);
         ast->varMembers.push_back(dummyMember);
     }
+
+    ast->InvalidateMemberIndex();
 }
 
 /* --- Declaration statements --- */
@@ -7,11 +7,15 @@
 
 #include "GLSLGenerator.h"
 #include "GLSLExtensionAgent.h"
+#include "GLSLExtensions.h"
 #include "GLSLConverter.h"
 #include "GLSLKeywords.h"
 #include "GLSLIntrinsics.h"
 #include "ReferenceAnalyzer.h"
 #include "StructParameterAnalyzer.h"
+#include "PrecisionAnalyzer.h"
+#include "UniformPackingAnalyzer.h"
+#include "GLSLMemoryLayout.h"
 #include "TypeDenoter.h"
 #include "Exception.h"
 #include "Helper.h"
@@ -61,6 +65,9 @@ void GLSLGenerator::GenerateCodePrimary(
     explicitBinding_    = outputDesc.options.explicitBinding;
     preserveComments_   = outputDesc.options.preserveComments;
     separateShaders_    = outputDesc.options.separateShaders;
+    precisionInference_ = outputDesc.options.precisionInference;
+    pushConstantLimit_  = outputDesc.options.pushConstantLimit;
+    packUniforms_       = outputDesc.options.packUniforms;
     allowLineMarks_     = outputDesc.formatting.lineMarks;
     compactWrappers_    = outputDesc.formatting.compactWrappers;
     alwaysBracedScopes_ = outputDesc.formatting.alwaysBracedScopes;
@@ -94,6 +101,19 @@ void GLSLGenerator::GenerateCodePrimary(
                 refAnalyzer.MarkReferencesFromEntryPoint(program, inputDesc.shaderTarget);
             }
 
+            /* Infer precision qualifiers for all reachable declarations */
+            if (IsESSL())
+            {
+                PrecisionAnalyzer precisionAnalyzer;
+                precisionAnalyzer.MarkPrecisionQualifiers(program, precisionInference_);
+            }
+
+            /* Select constant buffer for the push constant block */
+            SelectPushConstantBuffer(program);
+
+            /* Select constant buffers that are packed into 'vec4' arrays */
+            SelectPackedUniformBuffers(program);
+
             /* Write header */
             if (inputDesc.entryPoint.empty())
                 WriteComment("GLSL " + ToString(GetShaderTarget()));
@@ -171,6 +191,16 @@ bool GLSLGenerator::IsVKSL() const
     return IsLanguageVKSL(versionOut_);
 }
 
+bool GLSLGenerator::IsUniformBlockSupported() const
+{
+    return (versionOut_ >= OutputShaderVersion::GLSL140 && versionOut_ != OutputShaderVersion::ESSL100);
+}
+
+bool GLSLGenerator::IsMemberOffsetSupported() const
+{
+    return ( IsVKSL() || ( IsGLSL() && ( versionOut_ >= OutputShaderVersion::GLSL440 || enhancedLayoutsExt_ ) ) );
+}
+
 const std::string* GLSLGenerator::BufferTypeToKeyword(const BufferType bufferType, const AST* ast)
 {
     if (auto keyword = BufferTypeToGLSLKeyword(bufferType, IsVKSL()))
@@ -438,7 +468,29 @@ IMPLEMENT_VISIT_PROC(UniformBufferDecl)
     if (!ast->flags(AST::isReachable))
         return;
 
-    if (versionOut_ < OutputShaderVersion::GLSL140)
+    if (ast->flags(UniformBufferDecl::isPackedUniforms))
+    {
+        /* Write all members as a single 'vec4' array with the packing rules of HLSL constant buffers */
+        const auto bufferLayout = GetGLSLBlockLayout(ast->varMembers, GLSLMemoryLayout::Packed);
+
+        WriteLineMark(ast);
+
+        BeginLn();
+        {
+            Write("uniform ");
+            WriteDataType(DataType::Float4, IsESSL(), ast);
+            Write(" " + ast->ident + "[" + std::to_string((bufferLayout.size + 15u) / 16u) + "];");
+        }
+        EndLn();
+
+        /* Write static members as global variables */
+        for (auto& varDeclStmnt : ast->varMembers)
+        {
+            if (varDeclStmnt->typeSpecifier->HasAnyStorageClassesOf({ StorageClass::Static }))
+                Visit(varDeclStmnt);
+        }
+    }
+    else if (!IsUniformBlockSupported())
     {
         /* Write individual uniforms */
         for (auto& varDeclStmnt : ast->varMembers)
@@ -449,18 +501,27 @@ IMPLEMENT_VISIT_PROC(UniformBufferDecl)
     }
     else
     {
+        /* Explicit member offsets must be in increasing order */
+        if (IsMemberOffsetSupported())
+            ValidateUniformBufferMemberOffsets(ast);
+
         /* Write uniform buffer header */
         WriteLineMark(ast);
 
         /* Write uniform buffer declaration */
         BeginLn();
 
-        WriteLayout(
-            {
-                [&]() { Write("std140"); },
-                [&]() { WriteLayoutBinding(ast->slotRegisters); },
-            }
-        );
+        if (ast->flags(UniformBufferDecl::isPushConstant))
+            WriteLayout("push_constant");
+        else
+        {
+            WriteLayout(
+                {
+                    [&]() { Write("std140"); },
+                    [&]() { WriteLayoutBinding(ast->slotRegisters); },
+                }
+            );
+        }
 
         Write("uniform " + ast->ident);
 
@@ -557,56 +618,23 @@ IMPLEMENT_VISIT_PROC(VarDeclStmnt)
     if (ast->typeSpecifier->HasAnyStorageClassesOf({ StorageClass::Static }) && ast->FetchStructDeclRef() != nullptr)
         return;
 
-    BeginLn();
-
-    /* Write storage classes and interpolation modifiers (must be before in/out keywords) */
-    if (!InsideStructDecl())
+    /* Write specialization constant (only supported for Vulkan) */
+    if (IsVKSL() && varDecls.front()->specConstantId >= 0)
     {
-        WriteInterpModifiers(ast->typeSpecifier->interpModifiers, ast);
-        WriteStorageClasses(ast->typeSpecifier->storageClasses, ast);
+        WriteSpecConstant(ast);
+        return;
     }
 
-    Separator();
-
-    /* Write input modifiers */
-    if (ast->flags(VarDeclStmnt::isShaderInput))
-        Write("in ");
-    else if (ast->flags(VarDeclStmnt::isShaderOutput))
-        Write("out ");
-    else if (ast->IsUniform())
-        Write("uniform ");
-
-    Separator();
-
-    /* Write type modifiers */
-    WriteTypeModifiersFrom(ast->typeSpecifier);
-    Separator();
+    /* Write uniform buffer members with 'packoffset' separately, since each of them needs its own offset */
+    auto HasPackOffset = [](const VarDeclPtr& varDecl) { return (varDecl->packOffset != nullptr); };
 
-    /* Write variable type */
-    if (ast->typeSpecifier->structDecl)
+    if (InsideUniformBufferDecl() && varDecls.size() > 1 && IsMemberOffsetSupported() && std::any_of(varDecls.begin(), varDecls.end(), HasPackOffset))
     {
-        /* Do not end line here with "EndLn" */
-        Visit(ast->typeSpecifier);
-        BeginLn();
+        for (const auto& varDecl : varDecls)
+            WriteVarDeclStmnt(ast, { varDecl });
     }
     else
-    {
-        Visit(ast->typeSpecifier);
-        Write(" ");
-    }
-
-    Separator();
-
-    /* Write variable declarations */
-    for (std::size_t i = 0; i < varDecls.size(); ++i)
-    {
-        Visit(varDecls[i]);
-        if (i + 1 < varDecls.size())
-            Write(", ");
-    }
-
-    Write(";");
-    EndLn();
+        WriteVarDeclStmnt(ast, varDecls);
 }
 
 IMPLEMENT_VISIT_PROC(AliasDeclStmnt)
@@ -974,6 +1002,8 @@ void GLSLGenerator::WriteProgramHeader()
         }
     );
 
+    enhancedLayoutsExt_ = (requiredExtensions.find(E_GL_ARB_enhanced_layouts) != requiredExtensions.end());
+
     /* Write GLSL version */
     WriteProgramHeaderVersion();
     Blank();
@@ -1487,7 +1517,7 @@ void GLSLGenerator::WriteGlobalInputSemanticsVarDecl(VarDecl* varDecl)
 
         if (versionOut_ <= OutputShaderVersion::GLSL120)
         {
-            if (WarnEnabled(Warnings::Basic) && !interpModifiers.empty())
+            if (WarnEnabled(Warnings::Basic) && !interpModifiers.Empty())
                 Warning(R_InterpModNotSupportedForGLSL120, varDecl);
 
             if (IsVertexShader())
@@ -1649,7 +1679,7 @@ void GLSLGenerator::WriteGlobalOutputSemanticsSlot(TypeSpecifier* typeSpecifier,
 
         if (versionOut_ <= OutputShaderVersion::GLSL120)
         {
-            if (WarnEnabled(Warnings::Basic) && varDeclStmnt && !varDeclStmnt->typeSpecifier->interpModifiers.empty())
+            if (WarnEnabled(Warnings::Basic) && varDeclStmnt && !varDeclStmnt->typeSpecifier->interpModifiers.Empty())
                 Warning(R_InterpModNotSupportedForGLSL120, varDecl);
 
             Write("varying ");
@@ -1871,7 +1901,9 @@ void GLSLGenerator::WriteVarDeclIdentOrSystemValue(VarDecl* varDecl, int arrayIn
 
 void GLSLGenerator::WriteObjectExpr(const ObjectExpr& objectExpr)
 {
-    if (objectExpr.flags(ObjectExpr::isImmutable))
+    if (auto memberLayout = FindPackedUniformMember(objectExpr.symbolRef))
+        WritePackedUniformMember(*memberLayout);
+    else if (objectExpr.flags(ObjectExpr::isImmutable))
         WriteObjectExprIdent(objectExpr);
     else if (auto symbol = objectExpr.symbolRef)
         WriteObjectExprIdentOrSystemValue(objectExpr, symbol);
@@ -1973,6 +2005,24 @@ void GLSLGenerator::WriteObjectExprIdentOrSystemValue(const ObjectExpr& objectEx
 
 void GLSLGenerator::WriteArrayExpr(const ArrayExpr& arrayExpr)
 {
+    if (auto objectExpr = arrayExpr.prefixExpr->As<ObjectExpr>())
+    {
+        if (auto memberLayout = FindPackedUniformMember(objectExpr->symbolRef))
+        {
+            /* Write first array index into the register index of the packed array, and the remaining indices as usual */
+            WritePackedUniformMember(*memberLayout, arrayExpr.arrayIndices.front().get());
+
+            for (std::size_t i = 1; i < arrayExpr.arrayIndices.size(); ++i)
+            {
+                Write("[");
+                Visit(arrayExpr.arrayIndices[i]);
+                Write("]");
+            }
+
+            return;
+        }
+    }
+
     Visit(arrayExpr.prefixExpr);
     WriteArrayIndices(arrayExpr.arrayIndices);
 }
@@ -1989,7 +2039,7 @@ void GLSLGenerator::WriteArrayIndices(const std::vector<ExprPtr>& arrayIndices)
 
 /* ----- Type denoter ----- */
 
-void GLSLGenerator::WriteStorageClasses(const std::set<StorageClass>& storageClasses, const AST* ast)
+void GLSLGenerator::WriteStorageClasses(const EnumFlags<StorageClass>& storageClasses, const AST* ast)
 {
     for (auto storage : storageClasses)
     {
@@ -2004,7 +2054,7 @@ void GLSLGenerator::WriteStorageClasses(const std::set<StorageClass>& storageCla
     }
 }
 
-void GLSLGenerator::WriteInterpModifiers(const std::set<InterpModifier>& interpModifiers, const AST* ast)
+void GLSLGenerator::WriteInterpModifiers(const EnumFlags<InterpModifier>& interpModifiers, const AST* ast)
 {
     for (auto modifier : interpModifiers)
     {
@@ -2015,17 +2065,30 @@ void GLSLGenerator::WriteInterpModifiers(const std::set<InterpModifier>& interpM
     }
 }
 
-void GLSLGenerator::WriteTypeModifiers(const std::set<TypeModifier>& typeModifiers, const TypeDenoterPtr& typeDenoter)
+void GLSLGenerator::WriteTypeModifiers(const EnumFlags<TypeModifier>& typeModifiers, const TypeDenoterPtr& typeDenoter, int memberOffset)
 {
-    /* Matrix packing alignment can only be written for uniform buffers */
-    if (InsideUniformBufferDecl() && typeDenoter && typeDenoter->IsMatrix())
+    /* Matrix packing alignment and member offsets can only be written for uniform buffers */
+    if (InsideUniformBufferDecl())
     {
-        /* Only write 'row_major' type modifier (column major is the default) */
-        if (typeModifiers.find(TypeModifier::RowMajor) != typeModifiers.end())
-            WriteLayout("row_major");
+        WriteLayout(
+            {
+                [&]()
+                {
+                    /* Only write 'row_major' type modifier (column major is the default) */
+                    if (typeDenoter && typeDenoter->IsMatrix() && typeModifiers.Contains(TypeModifier::RowMajor))
+                        Write("row_major");
+                },
+                [&]()
+                {
+                    /* Write explicit member offset (from 'packoffset') */
+                    if (memberOffset >= 0)
+                        Write("offset = " + std::to_string(memberOffset));
+                },
+            }
+        );
     }
 
-    if (typeModifiers.find(TypeModifier::Const) != typeModifiers.end())
+    if (typeModifiers.Contains(TypeModifier::Const))
     {
         /*
         Write const type modifier, but only if GLSL version is at leat 420,
@@ -2037,9 +2100,9 @@ void GLSLGenerator::WriteTypeModifiers(const std::set<TypeModifier>& typeModifie
     }
 }
 
-void GLSLGenerator::WriteTypeModifiersFrom(const TypeSpecifierPtr& typeSpecifier)
+void GLSLGenerator::WriteTypeModifiersFrom(const TypeSpecifierPtr& typeSpecifier, int memberOffset)
 {
-    WriteTypeModifiers(typeSpecifier->typeModifiers, typeSpecifier->GetTypeDenoter()->GetSub());
+    WriteTypeModifiers(typeSpecifier->typeModifiers, typeSpecifier->GetTypeDenoter()->GetSub(), memberOffset);
 }
 
 void GLSLGenerator::WriteDataType(DataType dataType, bool writePrecisionSpecifier, const AST* ast)
@@ -2051,7 +2114,12 @@ void GLSLGenerator::WriteDataType(DataType dataType, bool writePrecisionSpecifie
     /* Write optional precision specifier */
     if (writePrecisionSpecifier)
     {
-        if (IsHalfRealType(dataType))
+        auto typeSpecifier = AST::GetAs<TypeSpecifier>(ast);
+        if (typeSpecifier && typeSpecifier->flags(TypeSpecifier::isMediumPrecision))
+            Write("mediump ");
+        else if (typeSpecifier && typeSpecifier->flags(TypeSpecifier::isHighPrecision))
+            Write("highp ");
+        else if (IsHalfRealType(dataType))
             Write("mediump ");
         else
             Write("highp ");
@@ -2147,6 +2215,241 @@ void GLSLGenerator::WriteTypeDenoter(const TypeDenoter& typeDenoter, bool writeP
     }
 }
 
+/* ----- Push constants ----- */
+
+void GLSLGenerator::SelectPushConstantBuffer(Program& program)
+{
+    bool hasPushConstant = false;
+
+    for (auto& stmnt : program.globalStmnts)
+    {
+        auto uniformBufferDecl = AST::GetAs<UniformBufferDecl>(stmnt.get());
+        if (!uniformBufferDecl || !uniformBufferDecl->flags(UniformBufferDecl::isPushConstant))
+            continue;
+
+        /* Push constants are only supported for VKSL, and only for reachable buffers */
+        if (!IsVKSL() || pushConstantLimit_ == 0 || !uniformBufferDecl->flags(AST::isReachable))
+        {
+            uniformBufferDecl->flags.Remove(UniformBufferDecl::isPushConstant);
+            continue;
+        }
+
+        if (hasPushConstant)
+        {
+            /* Only a single push constant block is allowed per shader stage */
+            Warning(R_MultiplePushConstantBuffers(uniformBufferDecl->ident), uniformBufferDecl);
+            uniformBufferDecl->flags.Remove(UniformBufferDecl::isPushConstant);
+            continue;
+        }
+
+        /* Push constant blocks use the 'std430' layout rules, so compare the size with that layout */
+        const auto bufferLayout = GetGLSLBlockLayout(uniformBufferDecl->varMembers, GLSLMemoryLayout::Std430);
+
+        if (bufferLayout.size > pushConstantLimit_)
+        {
+            Warning(
+                R_PushConstantExceedsLimit(std::to_string(pushConstantLimit_), uniformBufferDecl->ident, std::to_string(bufferLayout.size)),
+                uniformBufferDecl
+            );
+            uniformBufferDecl->flags.Remove(UniformBufferDecl::isPushConstant);
+        }
+        else
+            hasPushConstant = true;
+    }
+}
+
+/* ----- Packed uniforms ----- */
+
+void GLSLGenerator::SelectPackedUniformBuffers(Program& program)
+{
+    /* Constant buffers are only packed if they would otherwise be written as individual uniforms */
+    if (!packUniforms_ || IsUniformBlockSupported())
+        return;
+
+    UniformPackingAnalyzer::RejectionMap rejectedBuffers;
+    {
+        UniformPackingAnalyzer packingAnalyzer;
+        packingAnalyzer.MarkPackedUniformBuffers(program, rejectedBuffers);
+    }
+
+    for (const auto& it : rejectedBuffers)
+        Warning(R_CantPackUniformBuffer(it.first->ident, it.second->ident), it.first);
+
+    /* Store memory layouts of all members of the packed constant buffers */
+    for (auto& stmnt : program.globalStmnts)
+    {
+        auto uniformBufferDecl = AST::GetAs<UniformBufferDecl>(stmnt.get());
+        if (!uniformBufferDecl || !uniformBufferDecl->flags(UniformBufferDecl::isPackedUniforms))
+            continue;
+
+        std::vector<GLSLMemberLayout> memberLayouts;
+        if (GetGLSLBlockLayout(uniformBufferDecl->varMembers, GLSLMemoryLayout::Packed, &memberLayouts).size == 0)
+        {
+            /* Empty constant buffers can not be written as array */
+            uniformBufferDecl->flags.Remove(UniformBufferDecl::isPackedUniforms);
+            continue;
+        }
+
+        for (const auto& member : memberLayouts)
+            packedUniformMembers_[member.varDecl] = member;
+    }
+}
+
+const GLSLMemberLayout* GLSLGenerator::FindPackedUniformMember(const Decl* symbol) const
+{
+    if (symbol && !packedUniformMembers_.empty())
+    {
+        auto it = packedUniformMembers_.find(symbol);
+        if (it != packedUniformMembers_.end())
+            return &(it->second);
+    }
+    return nullptr;
+}
+
+void GLSLGenerator::WritePackedUniformRegister(const VarDecl& varDecl, unsigned int registerIndex, Expr* indexExpr)
+{
+    Write(varDecl.bufferDeclRef->ident);
+    Write("[");
+
+    if (indexExpr)
+    {
+        if (registerIndex > 0)
+            Write(std::to_string(registerIndex) + " + ");
+
+        /* Enclose index expression in brackets, if it might have a lower precedence than the addition */
+        const auto indexType = indexExpr->Type();
+
+        if (registerIndex > 0 && indexType != AST::Types::ObjectExpr && indexType != AST::Types::LiteralExpr &&
+            indexType != AST::Types::BracketExpr && indexType != AST::Types::CallExpr && indexType != AST::Types::ArrayExpr)
+        {
+            Write("(");
+            Visit(indexExpr);
+            Write(")");
+        }
+        else
+            Visit(indexExpr);
+    }
+    else
+        Write(std::to_string(registerIndex));
+
+    Write("]");
+}
+
+void GLSLGenerator::WritePackedUniformMember(const GLSLMemberLayout& memberLayout, Expr* indexExpr)
+{
+    static const std::string vectorComponents = "xyzw";
+
+    auto&       varDecl         = *memberLayout.varDecl;
+    const auto  registerIndex   = memberLayout.offset / 16u;
+    const auto  component       = (memberLayout.offset % 16u) / 4u;
+
+    /* Get base type of the member (or of the array elements) */
+    const auto* typeDen = &(varDecl.GetTypeDenoter()->GetAliased());
+
+    if (auto arrayTypeDen = typeDen->As<ArrayTypeDenoter>())
+        typeDen = &(arrayTypeDen->subTypeDenoter->GetAliased());
+
+    if (auto baseTypeDen = typeDen->As<BaseTypeDenoter>())
+    {
+        const auto dataType = baseTypeDen->dataType;
+
+        if (IsMatrixType(dataType))
+        {
+            /* Construct matrix "matCxR" from its registers, which either store the matrix rows (for 'row_major') or the matrix columns */
+            const auto matrixDim    = MatrixTypeDim(dataType);
+            const auto numColumns   = static_cast<unsigned int>(matrixDim.first);
+            const auto numRows      = static_cast<unsigned int>(matrixDim.second);
+
+            bool rowMajor = false;
+            if (auto typeSpecifier = varDecl.FetchTypeSpecifier())
+                rowMajor = typeSpecifier->typeModifiers.Contains(TypeModifier::RowMajor);
+
+            WriteDataType(dataType, false, &varDecl);
+            Write("(");
+
+            for (unsigned int column = 0; column < numColumns; ++column)
+            {
+                if (rowMajor)
+                {
+                    /* Write each scalar of the column from a different register (e.g. "Settings[0].x, Settings[1].x, ...") */
+                    for (unsigned int row = 0; row < numRows; ++row)
+                    {
+                        if (column > 0 || row > 0)
+                            Write(", ");
+                        WritePackedUniformRegister(varDecl, registerIndex + row);
+                        Write("." + vectorComponents.substr(column, 1));
+                    }
+                }
+                else
+                {
+                    /* Write entire column from a single register (e.g. "Settings[0].xyz, Settings[1].xyz, ...") */
+                    if (column > 0)
+                        Write(", ");
+                    WritePackedUniformRegister(varDecl, registerIndex + column);
+                    if (numRows < 4)
+                        Write("." + vectorComponents.substr(0, numRows));
+                }
+            }
+
+            Write(")");
+        }
+        else
+        {
+            /* Write scalar or vector with the swizzle of its components (e.g. "Settings[1].yzw") */
+            const auto numComponents = static_cast<unsigned int>(VectorTypeDim(dataType));
+
+            WritePackedUniformRegister(varDecl, registerIndex, indexExpr);
+
+            if (component > 0 || numComponents < 4)
+                Write("." + vectorComponents.substr(component, numComponents));
+        }
+    }
+}
+
+/* ----- Specialization constants ----- */
+
+void GLSLGenerator::WriteSpecConstant(VarDeclStmnt* varDeclStmnt)
+{
+    auto varDecl = varDeclStmnt->varDecls.front().get();
+
+    BeginLn();
+    {
+        /* Write layout qualifier with constant ID */
+        WriteLayout("constant_id = " + std::to_string(varDecl->specConstantId));
+
+        /* Write constant variable declaration (uniforms are converted to constants) */
+        Write("const ");
+        Visit(varDeclStmnt->typeSpecifier);
+        Write(" ");
+        Visit(varDecl);
+
+        /* Specialization constants always require a default value */
+        if (!varDecl->initializer)
+        {
+            Write(" = ");
+            WriteSpecConstantDefaultValue(varDecl->GetTypeDenoter()->GetAliased());
+        }
+
+        Write(";");
+    }
+    EndLn();
+}
+
+void GLSLGenerator::WriteSpecConstantDefaultValue(const TypeDenoter& typeDenoter)
+{
+    if (auto baseTypeDen = typeDenoter.As<BaseTypeDenoter>())
+    {
+        if (IsBooleanType(baseTypeDen->dataType))
+            Write("false");
+        else if (IsUIntType(baseTypeDen->dataType))
+            Write("0u");
+        else if (IsIntType(baseTypeDen->dataType))
+            Write("0");
+        else
+            Write("0.0");
+    }
+}
+
 /* ----- Function declaration ----- */
 
 void GLSLGenerator::WriteFunction(FunctionDecl* ast)
@@ -2598,7 +2901,7 @@ void GLSLGenerator::WriteWrapperIntrinsicsClip(const IntrinsicUsage& usage)
 
     for (const auto& argList : usage.argLists)
     {
-        auto arg0Type = (!argList.argTypes.empty() ? argList.argTypes.front() : DataType::Undefined);
+        auto arg0Type = (argList.numArgs > 0 ? argList.argTypes[0] : DataType::Undefined);
         
         if (IsScalarType(arg0Type) || IsVectorType(arg0Type))
         {
@@ -2676,7 +2979,7 @@ void GLSLGenerator::WriteWrapperIntrinsicsSinCos(const IntrinsicUsage& usage)
 
     for (const auto& argList : usage.argLists)
     {
-        if (argList.argTypes.size() == 3)
+        if (argList.numArgs == 3)
         {
             BeginLn();
             {
@@ -2772,6 +3075,101 @@ void GLSLGenerator::WriteWrapperIntrinsicsMemoryBarrier(const Intrinsic intrinsi
     Blank();
 }
 
+/* ----- Variable declaration ----- */
+
+void GLSLGenerator::WriteVarDeclStmnt(VarDeclStmnt* ast, const std::vector<VarDeclPtr>& varDecls)
+{
+    BeginLn();
+
+    /* Write storage classes and interpolation modifiers (must be before in/out keywords) */
+    if (!InsideStructDecl())
+    {
+        WriteInterpModifiers(ast->typeSpecifier->interpModifiers, ast);
+        WriteStorageClasses(ast->typeSpecifier->storageClasses, ast);
+    }
+
+    Separator();
+
+    /* Write input modifiers */
+    if (ast->flags(VarDeclStmnt::isShaderInput))
+        Write("in ");
+    else if (ast->flags(VarDeclStmnt::isShaderOutput))
+        Write("out ");
+    else if (ast->IsUniform())
+        Write("uniform ");
+
+    Separator();
+
+    /* Write type modifiers (and explicit offset for uniform buffer members with 'packoffset') */
+    WriteTypeModifiersFrom(ast->typeSpecifier, GetUniformBufferMemberOffset(varDecls));
+    Separator();
+
+    /* Write variable type */
+    if (ast->typeSpecifier->structDecl)
+    {
+        /* Do not end line here with "EndLn" */
+        Visit(ast->typeSpecifier);
+        BeginLn();
+    }
+    else
+    {
+        Visit(ast->typeSpecifier);
+        Write(" ");
+    }
+
+    Separator();
+
+    /* Write variable declarations */
+    for (std::size_t i = 0; i < varDecls.size(); ++i)
+    {
+        Visit(varDecls[i]);
+        if (i + 1 < varDecls.size())
+            Write(", ");
+    }
+
+    Write(";");
+    EndLn();
+}
+
+int GLSLGenerator::GetUniformBufferMemberOffset(const std::vector<VarDeclPtr>& varDecls)
+{
+    /* Only single uniform buffer members can have an explicit offset */
+    if (InsideUniformBufferDecl() && !InsideStructDecl() && varDecls.size() == 1 && IsMemberOffsetSupported())
+    {
+        /* Push constant blocks use the 'std430' layout rules, all other uniform buffers use 'std140' */
+        const auto memoryLayout = (GetUniformBufferDeclStack().back()->flags(UniformBufferDecl::isPushConstant) ? GLSLMemoryLayout::Std430 : GLSLMemoryLayout::Std140);
+        return GetGLSLPackOffset(*varDecls.front(), memoryLayout);
+    }
+    return -1;
+}
+
+void GLSLGenerator::ValidateUniformBufferMemberOffsets(const UniformBufferDecl* uniformBufferDecl)
+{
+    /* Get member layouts with the same rules as in 'GetUniformBufferMemberOffset' */
+    const auto memoryLayout = (uniformBufferDecl->flags(UniformBufferDecl::isPushConstant) ? GLSLMemoryLayout::Std430 : GLSLMemoryLayout::Std140);
+
+    std::vector<GLSLMemberLayout> memberLayouts;
+    GetGLSLBlockLayout(uniformBufferDecl->varMembers, memoryLayout, &memberLayouts);
+
+    const GLSLMemberLayout* prevMemberLayout = nullptr;
+
+    for (const auto& memberLayout : memberLayouts)
+    {
+        /* Each explicit offset must start behind the end of the previous member (HLSL allows any order, but GLSL does not) */
+        if (prevMemberLayout != nullptr && memberLayout.varDecl->packOffset != nullptr)
+        {
+            if (memberLayout.offset < prevMemberLayout->offset + prevMemberLayout->typeLayout.size)
+            {
+                Error(
+                    R_PackOffsetOverlapsPrevMember(memberLayout.varDecl->ident, prevMemberLayout->varDecl->ident),
+                    memberLayout.varDecl->packOffset.get()
+                );
+            }
+        }
+        prevMemberLayout = (&memberLayout);
+    }
+}
+
 /* ----- Structure ----- */
 
 bool GLSLGenerator::WriteStructDecl(StructDecl* structDecl, bool writeSemicolon, bool allowNestedStruct)
@@ -16,6 +16,7 @@
 #include "Token.h"
 #include "ASTEnums.h"
 #include "CiString.h"
+#include "GLSLMemoryLayout.h"
 #include <map>
 #include <set>
 #include <vector>
@@ -66,6 +67,12 @@ class GLSLGenerator : public Generator
         // Returns true if the output shader language is VKSL (for Vulkan/SPIR-V).
         bool IsVKSL() const;
 
+        // Returns true if the output shader version supports uniform blocks (i.e. GLSL 1.40+, ESSL 3.00+, and VKSL).
+        bool IsUniformBlockSupported() const;
+
+        // Returns true if explicit uniform block member offsets can be written (i.e. GLSL 4.40+, GL_ARB_enhanced_layouts, and VKSL, but not ESSL).
+        bool IsMemberOffsetSupported() const;
+
         // Returns the GLSL keyword for the specified buffer type or reports and error.
         const std::string* BufferTypeToKeyword(const BufferType bufferType, const AST* ast = nullptr);
 
@@ -219,15 +226,39 @@ class GLSLGenerator : public Generator
 
         /* ----- Type denoter ----- */
 
-        void WriteStorageClasses(const std::set<StorageClass>& storageClasses, const AST* ast = nullptr);
-        void WriteInterpModifiers(const std::set<InterpModifier>& interpModifiers, const AST* ast = nullptr);
-        void WriteTypeModifiers(const std::set<TypeModifier>& typeModifiers, const TypeDenoterPtr& typeDenoter = nullptr);
-        void WriteTypeModifiersFrom(const TypeSpecifierPtr& typeSpecifier);
+        void WriteStorageClasses(const EnumFlags<StorageClass>& storageClasses, const AST* ast = nullptr);
+        void WriteInterpModifiers(const EnumFlags<InterpModifier>& interpModifiers, const AST* ast = nullptr);
+        void WriteTypeModifiers(const EnumFlags<TypeModifier>& typeModifiers, const TypeDenoterPtr& typeDenoter = nullptr, int memberOffset = -1);
+        void WriteTypeModifiersFrom(const TypeSpecifierPtr& typeSpecifier, int memberOffset = -1);
 
         void WriteDataType(DataType dataType, bool writePrecisionSpecifier = false, const AST* ast = nullptr);
 
         void WriteTypeDenoter(const TypeDenoter& typeDenoter, bool writePrecisionSpecifier = false, const AST* ast = nullptr);
 
+        /* ----- Push constants ----- */
+
+        // Selects the constant buffer that is emitted as push constant block, and removes the push constant flag from all others.
+        void SelectPushConstantBuffer(Program& program);
+
+        /* ----- Packed uniforms ----- */
+
+        // Selects the constant buffers that are packed into 'vec4' arrays, and stores the memory layouts of their members.
+        void SelectPackedUniformBuffers(Program& program);
+
+        // Returns the packed memory layout of the specified variable, or null if the variable is not a member of a packed constant buffer.
+        const GLSLMemberLayout* FindPackedUniformMember(const Decl* symbol) const;
+
+        // Writes the 'vec4' array element of the specified register index (e.g. "Settings[2]").
+        void WritePackedUniformRegister(const VarDecl& varDecl, unsigned int registerIndex, Expr* indexExpr = nullptr);
+
+        // Writes the 'vec4' array elements of the specified packed member variable (e.g. "Settings[2].yz").
+        void WritePackedUniformMember(const GLSLMemberLayout& memberLayout, Expr* indexExpr = nullptr);
+
+        /* ----- Specialization constants ----- */
+
+        void WriteSpecConstant(VarDeclStmnt* varDeclStmnt);
+        void WriteSpecConstantDefaultValue(const TypeDenoter& typeDenoter);
+
         /* ----- Function declaration ----- */
 
         void WriteFunction(FunctionDecl* ast);
@@ -261,6 +292,16 @@ class GLSLGenerator : public Generator
         void WriteWrapperIntrinsicsSinCos(const IntrinsicUsage& usage);
         void WriteWrapperIntrinsicsMemoryBarrier(const Intrinsic intrinsic, bool groupSync);
 
+        /* ----- Variable declaration ----- */
+
+        void WriteVarDeclStmnt(VarDeclStmnt* ast, const std::vector<VarDeclPtr>& varDecls);
+
+        // Returns the explicit offset of the specified uniform buffer member (from 'packoffset'), or -1 if there is no explicit offset.
+        int GetUniformBufferMemberOffset(const std::vector<VarDeclPtr>& varDecls);
+
+        // Reports an error if the explicit member offsets (from 'packoffset') of the specified uniform buffer are not in increasing order or overlap.
+        void ValidateUniformBufferMemberOffsets(const UniformBufferDecl* uniformBufferDecl);
+
         /* ----- Structure ----- */
 
         bool WriteStructDecl(StructDecl* structDecl, bool writeSemicolon, bool allowNestedStruct = false);
@@ -307,6 +348,12 @@ class GLSLGenerator : public Generator
         bool                                    compactWrappers_        = false;
         bool                                    alwaysBracedScopes_     = false;
         bool                                    separateShaders_        = false;
+        PrecisionInference                      precisionInference_     = PrecisionInference::Disabled;
+        unsigned int                            pushConstantLimit_      = 0;
+        bool                                    packUniforms_           = false;
+        bool                                    enhancedLayoutsExt_     = false;    // GL_ARB_enhanced_layouts is enabled in the output.
+
+        std::map<const Decl*, GLSLMemberLayout> packedUniformMembers_;
 
         bool                                    isInsideInterfaceBlock_ = false;
 };
@@ -0,0 +1,263 @@
+/*
+ * GLSLMemoryLayout.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLSLMemoryLayout.h"
+#include "TypeDenoter.h"
+#include <algorithm>
+
+
+namespace Xsc
+{
+
+
+/*
+ * Internal functions
+ */
+
+static unsigned int AlignUp(unsigned int value, unsigned int alignment)
+{
+    return (alignment > 0 ? ((value + alignment - 1) / alignment) * alignment : value);
+}
+
+static unsigned int GetScalarSize(const DataType dataType)
+{
+    /* Only double-precision types have 8 bytes, all other scalars (incl. 'half' which is mapped to 'float') have 4 bytes */
+    return (IsDoubleRealType(dataType) ? 8u : 4u);
+}
+
+static GLSLTypeLayout GetVectorLayout(const DataType dataType, unsigned int vectorSize)
+{
+    GLSLTypeLayout layout;
+
+    const auto scalarSize = GetScalarSize(dataType);
+
+    layout.size         = scalarSize * vectorSize;
+    layout.alignment    = scalarSize * (vectorSize == 3 ? 4u : vectorSize);
+
+    return layout;
+}
+
+static GLSLTypeLayout GetArrayLayout(const GLSLTypeLayout& elementLayout, unsigned int numElements, const GLSLMemoryLayout memoryLayout)
+{
+    GLSLTypeLayout layout;
+
+    /* With 'std140' and packed layout the alignment of array elements is rounded up to the alignment of a 'vec4' */
+    layout.alignment    = (memoryLayout != GLSLMemoryLayout::Std430 ? AlignUp(elementLayout.alignment, 16u) : elementLayout.alignment);
+    layout.arrayStride  = AlignUp(elementLayout.size, layout.alignment);
+
+    /* With packed layout the last array element is not padded */
+    if (memoryLayout == GLSLMemoryLayout::Packed && numElements > 0)
+        layout.size = layout.arrayStride * (numElements - 1) + elementLayout.size;
+    else
+        layout.size = layout.arrayStride * numElements;
+
+    return layout;
+}
+
+static GLSLTypeLayout GetBaseTypeLayout(const DataType dataType, const GLSLMemoryLayout memoryLayout, bool rowMajor)
+{
+    if (IsMatrixType(dataType))
+    {
+        /* GLSL matrix "matCxR" is stored as C column vectors with R components (or R row vectors with C components for 'row_major') */
+        const auto matrixDim    = MatrixTypeDim(dataType);
+        const auto numColumns   = static_cast<unsigned int>(matrixDim.first);
+        const auto numRows      = static_cast<unsigned int>(matrixDim.second);
+
+        auto layout = GetArrayLayout(
+            GetVectorLayout(dataType, (rowMajor ? numColumns : numRows)),
+            (rowMajor ? numRows : numColumns),
+            memoryLayout
+        );
+
+        layout.matrixStride = layout.arrayStride;
+        layout.arrayStride  = 0;
+
+        return layout;
+    }
+    else
+    {
+        /* Scalars are laid out like vectors with only one component */
+        auto layout = GetVectorLayout(dataType, static_cast<unsigned int>(VectorTypeDim(dataType)));
+
+        /* With packed layout vectors are only aligned to their scalar size (see 'GetGLSLBlockLayout' for 'vec4' boundaries) */
+        if (memoryLayout == GLSLMemoryLayout::Packed)
+            layout.alignment = GetScalarSize(dataType);
+
+        return layout;
+    }
+}
+
+static int GetPackOffsetValue(const PackOffset& packOffset)
+{
+    /* Register "c<N>" selects a 16 byte register, and the optional vector component selects a 4 byte scalar within that register */
+    const auto& registerName = packOffset.registerName;
+
+    if (registerName.size() < 2 || (registerName[0] != 'c' && registerName[0] != 'C'))
+        return -1;
+
+    int offset = 0;
+
+    for (std::size_t i = 1; i < registerName.size(); ++i)
+    {
+        if (registerName[i] < '0' || registerName[i] > '9')
+            return -1;
+        offset = offset * 10 + (registerName[i] - '0');
+    }
+
+    offset *= 16;
+
+    if (!packOffset.vectorComponent.empty())
+    {
+        switch (packOffset.vectorComponent[0])
+        {
+            case 'x': case 'r': break;
+            case 'y': case 'g': offset += 4;  break;
+            case 'z': case 'b': offset += 8;  break;
+            case 'w': case 'a': offset += 12; break;
+            default:            return -1;
+        }
+    }
+
+    return offset;
+}
+
+static bool IsRowMajorMember(const VarDecl& varDecl)
+{
+    if (auto typeSpecifier = varDecl.FetchTypeSpecifier())
+        return typeSpecifier->typeModifiers.Contains(TypeModifier::RowMajor);
+    else
+        return false;
+}
+
+
+/*
+ * Global functions
+ */
+
+GLSLTypeLayout GetGLSLTypeLayout(const TypeDenoter& typeDenoter, const GLSLMemoryLayout memoryLayout, bool rowMajor)
+{
+    const auto& typeDen = typeDenoter.GetAliased();
+
+    if (auto baseTypeDen = typeDen.As<BaseTypeDenoter>())
+    {
+        /* Get layout of scalar, vector, or matrix type */
+        return GetBaseTypeLayout(baseTypeDen->dataType, memoryLayout, rowMajor);
+    }
+    else if (auto structTypeDen = typeDen.As<StructTypeDenoter>())
+    {
+        if (auto structDecl = structTypeDen->structDeclRef)
+        {
+            /* Get layout of structure members (with 'std140' and packed layout the structure alignment is rounded up to the alignment of a 'vec4') */
+            auto layout = GetGLSLBlockLayout(structDecl->varMembers, memoryLayout);
+
+            if (memoryLayout == GLSLMemoryLayout::Std140)
+            {
+                layout.alignment    = AlignUp(layout.alignment, 16u);
+                layout.size         = AlignUp(layout.size, layout.alignment);
+            }
+            else if (memoryLayout == GLSLMemoryLayout::Packed)
+                layout.alignment    = 16u;
+
+            return layout;
+        }
+    }
+    else if (auto arrayTypeDen = typeDen.As<ArrayTypeDenoter>())
+    {
+        /* Multi-dimensional arrays are laid out like one-dimensional arrays of the innermost element type */
+        unsigned int numElements = 1;
+
+        for (const auto& dim : arrayTypeDen->arrayDims)
+            numElements *= (dim != nullptr && dim->size > 0 ? static_cast<unsigned int>(dim->size) : 0u);
+
+        auto elementLayout = GetGLSLTypeLayout(*arrayTypeDen->subTypeDenoter, memoryLayout, rowMajor);
+
+        auto layout = GetArrayLayout(elementLayout, numElements, memoryLayout);
+        layout.matrixStride = elementLayout.matrixStride;
+
+        return layout;
+    }
+
+    return GLSLTypeLayout();
+}
+
+GLSLTypeLayout GetGLSLRuntimeArrayLayout(const TypeDenoter& elementTypeDenoter, const GLSLMemoryLayout memoryLayout)
+{
+    const auto elementLayout = GetGLSLTypeLayout(elementTypeDenoter, memoryLayout);
+
+    auto layout = GetArrayLayout(elementLayout, 1, memoryLayout);
+    layout.matrixStride = elementLayout.matrixStride;
+
+    return layout;
+}
+
+int GetGLSLPackOffset(VarDecl& varDecl, const GLSLMemoryLayout memoryLayout)
+{
+    if (varDecl.packOffset)
+    {
+        const auto offset = GetPackOffsetValue(*varDecl.packOffset);
+        if (offset >= 0)
+        {
+            const auto typeLayout = GetGLSLTypeLayout(*varDecl.GetTypeDenoter(), memoryLayout, IsRowMajorMember(varDecl));
+            return static_cast<int>(AlignUp(static_cast<unsigned int>(offset), typeLayout.alignment));
+        }
+    }
+    return -1;
+}
+
+GLSLTypeLayout GetGLSLBlockLayout(
+    const std::vector<VarDeclStmntPtr>& varMembers, const GLSLMemoryLayout memoryLayout, std::vector<GLSLMemberLayout>* memberLayouts, bool usePackOffsets)
+{
+    GLSLTypeLayout layout;
+
+    unsigned int offset = 0, size = 0;
+
+    for (const auto& varDeclStmnt : varMembers)
+    {
+        /* Static members are not part of the buffer */
+        if (varDeclStmnt->typeSpecifier->HasAnyStorageClassesOf({ StorageClass::Static }))
+            continue;
+
+        for (const auto& varDecl : varDeclStmnt->varDecls)
+        {
+            auto memberLayout = GetGLSLTypeLayout(*varDecl->GetTypeDenoter(), memoryLayout, IsRowMajorMember(*varDecl));
+
+            /* Align member offset (or take explicit offset from 'packoffset') and move to the end of the member */
+            const auto packOffset = (usePackOffsets ? GetGLSLPackOffset(*varDecl, memoryLayout) : -1);
+
+            if (packOffset >= 0)
+                offset = static_cast<unsigned int>(packOffset);
+            else
+            {
+                offset = AlignUp(offset, memberLayout.alignment);
+
+                /* With packed layout members must not cross a 'vec4' boundary */
+                if (memoryLayout == GLSLMemoryLayout::Packed && (offset % 16u) + memberLayout.size > 16u)
+                    offset = AlignUp(offset, 16u);
+            }
+
+            if (memberLayouts)
+                memberLayouts->push_back({ varDecl.get(), offset, memberLayout });
+
+            offset += memberLayout.size;
+            size = std::max(size, offset);
+
+            layout.alignment = std::max(layout.alignment, memberLayout.alignment);
+        }
+    }
+
+    /* With packed layout the block is not padded to its alignment */
+    layout.size = (memoryLayout == GLSLMemoryLayout::Packed ? size : AlignUp(size, layout.alignment));
+
+    return layout;
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
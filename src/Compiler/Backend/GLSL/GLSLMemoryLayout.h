@@ -0,0 +1,82 @@
+/*
+ * GLSLMemoryLayout.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_GLSL_MEMORY_LAYOUT_H
+#define XSC_GLSL_MEMORY_LAYOUT_H
+
+
+#include "AST.h"
+#include <vector>
+
+
+namespace Xsc
+{
+
+
+// GLSL memory layout qualifiers for buffer blocks.
+enum class GLSLMemoryLayout
+{
+    Std140, // Layout qualifier 'std140' (default for uniform blocks).
+    Std430, // Layout qualifier 'std430' (default for storage buffers and push constants).
+    Packed, // HLSL constant buffer packing rules, used for constant buffers that are packed into a 'vec4' array.
+};
+
+// Memory layout of a type inside a buffer block (all values in bytes).
+struct GLSLTypeLayout
+{
+    unsigned int size           = 0; // Size of the type (including the padding of array elements).
+    unsigned int alignment      = 0; // Base alignment of the type.
+    unsigned int arrayStride    = 0; // Stride between two array elements, or 0 if the type is not an array.
+    unsigned int matrixStride   = 0; // Stride between two matrix columns (or rows for 'row_major'), or 0 if the type is not a matrix.
+};
+
+// Memory layout of a member variable inside a buffer block.
+struct GLSLMemberLayout
+{
+    VarDecl*        varDecl     = nullptr;  // Reference to the member variable.
+    unsigned int    offset      = 0;        // Offset (in bytes) from the start of the buffer block.
+    GLSLTypeLayout  typeLayout;             // Memory layout of the member type.
+};
+
+/*
+Returns the memory layout of the specified type denoter with the specified layout rules (see GLSL spec. 4.50, section 7.6.2.2).
+Matrices are stored as arrays of column vectors, unless 'rowMajor' is true.
+*/
+GLSLTypeLayout GetGLSLTypeLayout(const TypeDenoter& typeDenoter, const GLSLMemoryLayout memoryLayout, bool rowMajor = false);
+
+/*
+Returns the memory layout of an array of variable size (e.g. the array inside a storage buffer) with the specified element type.
+The size is determined as if the array had a single element.
+*/
+GLSLTypeLayout GetGLSLRuntimeArrayLayout(const TypeDenoter& elementTypeDenoter, const GLSLMemoryLayout memoryLayout);
+
+/*
+Returns the explicit offset (in bytes) of the specified member variable from its 'packoffset', or -1 if there is no 'packoffset'.
+The offset is rounded up to the base alignment of the member type, since GLSL does not allow unaligned member offsets.
+*/
+int GetGLSLPackOffset(VarDecl& varDecl, const GLSLMemoryLayout memoryLayout);
+
+/*
+Returns the memory layout of a buffer block with the specified member variables (including their 'packoffset', if 'usePackOffsets' is true).
+The layout of each member variable is appended to 'memberLayouts' (if not null).
+*/
+GLSLTypeLayout GetGLSLBlockLayout(
+    const std::vector<VarDeclStmntPtr>&     varMembers,
+    const GLSLMemoryLayout                  memoryLayout,
+    std::vector<GLSLMemberLayout>*          memberLayouts   = nullptr,
+    bool                                    usePackOffsets  = true
+);
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -12,6 +12,7 @@
 #include <ctime>
 #include <chrono>
 #include <iomanip>
+#include <mutex>
 
 
 namespace Xsc
@@ -193,8 +194,16 @@ std::string Generator::TimePoint() const
     auto currentTime    = std::chrono::system_clock::now();
     auto date           = std::chrono::system_clock::to_time_t(currentTime);
 
+    /* Copy local time with a lock, since 'localtime' returns a pointer to a shared object */
+    std::tm localTime;
+    {
+        static std::mutex localTimeMutex;
+        std::lock_guard<std::mutex> guard { localTimeMutex };
+        localTime = *std::localtime(&date);
+    }
+
     std::stringstream s;
-    s << std::put_time(std::localtime(&date), "%d/%m/%Y %H:%M:%S");
+    s << std::put_time(&localTime, "%d/%m/%Y %H:%M:%S");
 
     return s.str();
 }
@@ -0,0 +1,150 @@
+/*
+ * EnumFlags.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_ENUM_FLAGS_H
+#define XSC_ENUM_FLAGS_H
+
+
+#include <initializer_list>
+
+
+namespace Xsc
+{
+
+
+/*
+Flags class for the entries of an enumeration, as compact replacement for an 'std::set' of enumeration entries.
+The enumeration entries must be in the range [0, 32). The entries are iterated in ascending order (like with 'std::set').
+*/
+template <typename T>
+class EnumFlags
+{
+
+    public:
+
+        // Forward iterator over all contained enumeration entries.
+        class Iterator
+        {
+
+            public:
+
+                inline Iterator(unsigned int bitMask) :
+                    bitMask_ { bitMask }
+                {
+                }
+
+                inline T operator * () const
+                {
+                    unsigned int index = 0;
+                    while ((bitMask_ & (1u << index)) == 0)
+                        ++index;
+                    return static_cast<T>(index);
+                }
+
+                // Removes the lowest bit, i.e. the current entry.
+                inline Iterator& operator ++ ()
+                {
+                    bitMask_ &= (bitMask_ - 1u);
+                    return *this;
+                }
+
+                inline bool operator != (const Iterator& rhs) const
+                {
+                    return (bitMask_ != rhs.bitMask_);
+                }
+
+            private:
+
+                unsigned int bitMask_ = 0;
+
+        };
+
+        EnumFlags() = default;
+        EnumFlags(const EnumFlags&) = default;
+        EnumFlags& operator = (const EnumFlags&) = default;
+
+        // Initializes the object with the specified enumeration entries.
+        inline EnumFlags(std::initializer_list<T> values)
+        {
+            for (auto value : values)
+                Insert(value);
+        }
+
+        // Inserts the specified enumeration entry.
+        inline void Insert(const T value)
+        {
+            bitMask_ |= Bit(value);
+        }
+
+        // Removes the specified enumeration entry.
+        inline void Remove(const T value)
+        {
+            bitMask_ &= (~Bit(value));
+        }
+
+        // Returns true if the specified enumeration entry is contained.
+        inline bool Contains(const T value) const
+        {
+            return ((bitMask_ & Bit(value)) != 0);
+        }
+
+        // Returns true if any of the specified enumeration entries is contained.
+        inline bool Any(const EnumFlags& values) const
+        {
+            return ((bitMask_ & values.bitMask_) != 0);
+        }
+
+        // Returns true if no enumeration entry is contained.
+        inline bool Empty() const
+        {
+            return (bitMask_ == 0);
+        }
+
+        inline Iterator begin() const
+        {
+            return Iterator { bitMask_ };
+        }
+
+        inline Iterator end() const
+        {
+            return Iterator { 0 };
+        }
+
+        // Returns the bit mask of all contained enumeration entries (bit N for the entry with value N).
+        inline unsigned int BitMask() const
+        {
+            return bitMask_;
+        }
+
+        // Returns an object with the specified bit mask (see 'BitMask').
+        static inline EnumFlags FromBitMask(unsigned int bitMask)
+        {
+            EnumFlags flags;
+            flags.bitMask_ = bitMask;
+            return flags;
+        }
+
+    private:
+
+        static inline unsigned int Bit(const T value)
+        {
+            return (1u << static_cast<unsigned int>(value));
+        }
+
+        unsigned int bitMask_ = 0;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
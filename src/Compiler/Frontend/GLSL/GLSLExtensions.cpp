@@ -34,7 +34,7 @@ const std::map<std::string, int>& GetGLSLExtensionVersionMap()
         { E_GL_ARB_compute_shader,                          110 },
         { E_GL_ARB_cull_distance,                           110 },
         { E_GL_ARB_derivative_control,                      450 },
-        { E_GL_ARB_enhanced_layouts,                        430 },
+        { E_GL_ARB_enhanced_layouts,                        440 },
         { E_GL_ARB_explicit_attrib_location,                110 },
         { E_GL_ARB_fragment_coord_conventions,              150 },
         { E_GL_ARB_gpu_shader5,                             330 },
@@ -310,6 +310,13 @@ IMPLEMENT_VISIT_PROC(UniformBufferDecl)
             Error(R_UserCBuffersCantBeTargetSpecific, slotRegister.get());
     }
 
+    /* Analyze optional push constant attribute */
+    for (const auto& attr : ast->attribs)
+    {
+        if (attr->attributeType == AttributeType::PushConstant)
+            AnalyzeAttributePushConstant(attr.get(), ast);
+    }
+
     PushUniformBufferDecl(ast);
     {
         Visit(ast->localStmnts);
@@ -327,6 +334,13 @@ IMPLEMENT_VISIT_PROC(VarDeclStmnt)
     Visit(ast->typeSpecifier);
     Visit(ast->varDecls);
 
+    /* Analyze optional specialization constant attribute */
+    for (const auto& attr : ast->attribs)
+    {
+        if (attr->attributeType == AttributeType::ConstantId)
+            AnalyzeAttributeConstantId(attr.get(), ast);
+    }
+
     /* Is the 'snorm' or 'unorm' type modifier specified? */
     if (ast->HasAnyTypeModifierOf({ TypeModifier::SNorm, TypeModifier::UNorm }))
     {
@@ -2050,6 +2064,59 @@ void HLSLAnalyzer::AnalyzeAttributeMaxVertexCount(Attribute* ast)
     }
 }
 
+void HLSLAnalyzer::AnalyzeAttributeConstantId(Attribute* ast, VarDeclStmnt* varDeclStmnt)
+{
+    if (AnalyzeNumArgsAttribute(ast, 1))
+    {
+        /* Specialization constants must be single global constants of scalar type */
+        if (!InsideGlobalScope() || InsideUniformBufferDecl() || InsideStructDecl() || !varDeclStmnt->IsConstOrUniform())
+            Error(R_SpecConstantMustBeGlobalConst, ast);
+        else if (varDeclStmnt->varDecls.size() != 1)
+            Error(R_SpecConstantMustBeSingleVar, ast);
+        else
+        {
+            auto varDecl = varDeclStmnt->varDecls.front().get();
+
+            const auto& typeDen = varDecl->GetTypeDenoter()->GetAliased();
+            if (!typeDen.IsScalar())
+            {
+                Error(R_SpecConstantMustBeScalar(typeDen.ToString()), varDecl);
+                return;
+            }
+
+            /* Evaluate specialization constant ID */
+            int exprValue = EvaluateConstExprInt(*ast->arguments[0]);
+            if (exprValue < 0)
+            {
+                Error(R_SpecConstantIdMustNotBeNegative, ast);
+                return;
+            }
+
+            /* Check for duplicate IDs */
+            auto it = specConstantIds_.find(exprValue);
+            if (it != specConstantIds_.end())
+                Error(R_DuplicateSpecConstantId(exprValue, it->second->ident), ast);
+            else
+            {
+                specConstantIds_[exprValue] = varDecl;
+                varDecl->specConstantId = exprValue;
+            }
+        }
+    }
+}
+
+void HLSLAnalyzer::AnalyzeAttributePushConstant(Attribute* ast, UniformBufferDecl* uniformBufferDecl)
+{
+    if (AnalyzeNumArgsAttribute(ast, 0))
+    {
+        /* Push constants can only be used for constant buffers */
+        if (uniformBufferDecl->bufferType != UniformBufferType::ConstantBuffer)
+            Error(R_PushConstantMustBeCBuffer, ast);
+        else
+            uniformBufferDecl->flags << UniformBufferDecl::isPushConstant;
+    }
+}
+
 void HLSLAnalyzer::AnalyzeAttributeNumThreads(Attribute* ast)
 {
     if (AnalyzeNumArgsAttribute(ast, 3))
@@ -165,6 +165,9 @@ class HLSLAnalyzer : public Analyzer
 
         void AnalyzeAttributeMaxVertexCount(Attribute* ast);
 
+        void AnalyzeAttributeConstantId(Attribute* ast, VarDeclStmnt* varDeclStmnt);
+        void AnalyzeAttributePushConstant(Attribute* ast, UniformBufferDecl* uniformBufferDecl);
+
         void AnalyzeAttributeNumThreads(Attribute* ast);
         void AnalyzeAttributeNumThreadsArgument(Expr* ast, unsigned int& value);
 
@@ -199,18 +202,19 @@ class HLSLAnalyzer : public Analyzer
         
         /* === Members === */
 
-        Program*            program_                    = nullptr;
+        Program*                program_                    = nullptr;
 
-        std::string         entryPoint_;
-        std::string         secondaryEntryPoint_;
-        bool                secondaryEntryPointFound_   = false;
+        std::string             entryPoint_;
+        std::string             secondaryEntryPoint_;
+        bool                    secondaryEntryPointFound_   = false;
 
-        ShaderTarget        shaderTarget_               = ShaderTarget::VertexShader;
-        InputShaderVersion  versionIn_                  = InputShaderVersion::HLSL5;
-        ShaderVersion       shaderModel_                = { 5, 0 };
-        bool                preferWrappers_             = false;
+        ShaderTarget            shaderTarget_               = ShaderTarget::VertexShader;
+        InputShaderVersion      versionIn_                  = InputShaderVersion::HLSL5;
+        ShaderVersion           shaderModel_                = { 5, 0 };
+        bool                    preferWrappers_             = false;
 
-        std::set<VarDecl*>  varDeclSM3Semantics_;
+        std::set<VarDecl*>      varDeclSM3Semantics_;
+        std::map<int, VarDecl*> specConstantIds_;
 
 };
 
@@ -278,35 +278,75 @@ static TypeDenoterPtr DeriveCommonTypeDenoter(std::size_t majorArgIndex, const s
     return nullptr;
 }
 
+// Parameter types of an intrinsic, i.e. the legal base types and dimensions of its arguments.
+enum class IntrinsicParamType
+{
+    Generic,        // Common type of all arguments
+    GenericMinDim,  // Common type of all arguments with the minimal vector dimension (e.g. for 'dot')
+    Float,          // Common type of all arguments, but integral and boolean types are converted to float (e.g. for 'sin')
+};
+
+// Converts the specified type denoter to a floating-point type denoter with the same dimension, if it has an integral or boolean base type.
+static TypeDenoterPtr ConvertToFloatTypeDenoter(const TypeDenoterPtr& typeDen)
+{
+    if (auto baseTypeDen = typeDen->As<BaseTypeDenoter>())
+    {
+        const auto dataType = baseTypeDen->dataType;
+        if (IsIntegralType(dataType) || IsBooleanType(dataType))
+        {
+            if (IsMatrixType(dataType))
+            {
+                const auto matrixTypeDim = MatrixTypeDim(dataType);
+                return BaseTypeDenoter::GetCanonical(MatrixDataType(DataType::Float, matrixTypeDim.first, matrixTypeDim.second));
+            }
+            else
+                return BaseTypeDenoter::GetCanonical(VectorDataType(DataType::Float, VectorTypeDim(dataType)));
+        }
+    }
+    return typeDen;
+}
+
 struct IntrinsicSignature
 {
     IntrinsicSignature(int numArgs = 0);
     IntrinsicSignature(int numArgsMin, int numArgsMax);
-    IntrinsicSignature(IntrinsicReturnType returnType, int numArgs = 0);
+    IntrinsicSignature(IntrinsicReturnType returnType, int numArgs = 0, IntrinsicParamType paramType = IntrinsicParamType::Generic);
 
     TypeDenoterPtr GetTypeDenoterWithArgs(const std::vector<ExprPtr>& args) const;
 
-    IntrinsicReturnType returnType = IntrinsicReturnType::Void;
-    int                 numArgsMin = 0;
-    int                 numArgsMax = 0;
+    // Returns the common parameter type denoter for the specified arguments.
+    TypeDenoterPtr GetParamTypeDenoterWithArgs(const std::vector<ExprPtr>& args) const;
+
+    bool                valid       = false;
+    IntrinsicReturnType returnType  = IntrinsicReturnType::Void;
+    IntrinsicParamType  paramType   = IntrinsicParamType::Generic;
+    int                 numArgsMin  = 0;
+    int                 numArgsMax  = 0;
+
+    // Canonical type denoter for fixed return types, which is shared between all calls.
+    TypeDenoterPtr      returnTypeDenoter;
 };
 
 IntrinsicSignature::IntrinsicSignature(int numArgs) :
-    numArgsMin { numArgs },
-    numArgsMax { numArgs }
+    valid       { true    },
+    numArgsMin  { numArgs },
+    numArgsMax  { numArgs }
 {
 }
 
 IntrinsicSignature::IntrinsicSignature(int numArgsMin, int numArgsMax) :
-    numArgsMin { numArgsMin },
-    numArgsMax { numArgsMax }
+    valid       { true       },
+    numArgsMin  { numArgsMin },
+    numArgsMax  { numArgsMax }
 {
 }
 
-IntrinsicSignature::IntrinsicSignature(IntrinsicReturnType returnType, int numArgs) :
-    returnType { returnType },
-    numArgsMin { numArgs    },
-    numArgsMax { numArgs    }
+IntrinsicSignature::IntrinsicSignature(IntrinsicReturnType returnType, int numArgs, IntrinsicParamType paramType) :
+    valid       { true       },
+    returnType  { returnType },
+    paramType   { paramType  },
+    numArgsMin  { numArgs    },
+    numArgsMax  { numArgs    }
 {
 }
 
@@ -330,266 +370,313 @@ TypeDenoterPtr IntrinsicSignature::GetTypeDenoterWithArgs(const std::vector<Expr
         }
     }
 
-    if (returnType != IntrinsicReturnType::Void)
+    /* Return fixed type denoter (also for void) */
+    if (returnTypeDenoter)
+        return returnTypeDenoter;
+
+    /* Take type denoter from argument */
+    const auto returnTypeByArgIndex = IntrinsicReturnTypeToArgIndex(returnType);
+    if (returnTypeByArgIndex < args.size())
     {
-        /* Return fixed base type denoter */
-        const auto returnTypeFixed = IntrinsicReturnTypeToDataType(returnType);
-        if (returnTypeFixed != DataType::Undefined)
-            return std::make_shared<BaseTypeDenoter>(returnTypeFixed);
-
-        /* Take type denoter from argument */
-        const auto returnTypeByArgIndex = IntrinsicReturnTypeToArgIndex(returnType);
-        if (returnTypeByArgIndex < args.size())
-            return DeriveCommonTypeDenoter(returnTypeByArgIndex, args);
+        auto typeDen = DeriveCommonTypeDenoter(returnTypeByArgIndex, args);
+        if (paramType == IntrinsicParamType::Float)
+            return ConvertToFloatTypeDenoter(typeDen);
+        else
+            return typeDen;
     }
 
     /* Return default void type denoter */
-    return std::make_shared<VoidTypeDenoter>();
+    return VoidTypeDenoter::GetCanonical();
 }
 
-static std::map<Intrinsic, IntrinsicSignature> GenerateIntrinsicSignatureMap()
+TypeDenoterPtr IntrinsicSignature::GetParamTypeDenoterWithArgs(const std::vector<ExprPtr>& args) const
+{
+    switch (paramType)
+    {
+        case IntrinsicParamType::GenericMinDim:
+            return DeriveCommonTypeDenoter(0, args, true);
+        case IntrinsicParamType::Float:
+            return ConvertToFloatTypeDenoter(DeriveCommonTypeDenoter(0, args));
+        default:
+            return DeriveCommonTypeDenoter(0, args);
+    }
+}
+
+// Returns the table of all intrinsic signatures (indexed by INTRINSIC_IDX).
+static std::vector<IntrinsicSignature> GenerateIntrinsicSignatureTable()
 {
     using T = Intrinsic;
     using Ret = IntrinsicReturnType;
+    using Par = IntrinsicParamType;
 
-    return
+    const std::initializer_list<std::pair<Intrinsic, IntrinsicSignature>> signatures
     {
-        { T::Abort,                            {                        } },
-        { T::Abs,                              { Ret::GenericArg0, 1    } },
-        { T::ACos,                             { Ret::GenericArg0, 1    } },
-        { T::All,                              { Ret::Bool,        1    } },
-        { T::AllMemoryBarrier,                 {                        } },
-        { T::AllMemoryBarrierWithGroupSync,    {                        } },
-        { T::Any,                              { Ret::Bool,        1    } },
-        { T::AsDouble,                         { Ret::Double,      2    } },
-        { T::AsFloat,                          { Ret::GenericArg0, 1    } },
-        { T::ASin,                             { Ret::GenericArg0, 1    } },
-        { T::AsInt,                            { Ret::GenericArg0, 1    } },
-        { T::AsUInt_1,                         { Ret::GenericArg0, 1    } },
-        { T::AsUInt_3,                         {                   3    } },
-        { T::ATan,                             { Ret::GenericArg0, 1    } },
-        { T::ATan2,                            { Ret::GenericArg1, 2    } },
-        { T::Ceil,                             { Ret::GenericArg0, 1    } },
-        { T::CheckAccessFullyMapped,           { Ret::Bool,        1    } },
-        { T::Clamp,                            { Ret::GenericArg0, 3    } },
-        { T::Clip,                             {                   1    } },
-        { T::Cos,                              { Ret::GenericArg0, 1    } },
-        { T::CosH,                             { Ret::GenericArg0, 1    } },
-        { T::CountBits,                        { Ret::UInt,        1    } },
-        { T::Cross,                            { Ret::Float3,      2    } },
-        { T::D3DCOLORtoUBYTE4,                 { Ret::Int4,        1    } },
-        { T::DDX,                              { Ret::GenericArg0, 1    } },
-        { T::DDXCoarse,                        { Ret::GenericArg0, 1    } },
-        { T::DDXFine,                          { Ret::GenericArg0, 1    } },
-        { T::DDY,                              { Ret::GenericArg0, 1    } },
-        { T::DDYCoarse,                        { Ret::GenericArg0, 1    } },
-        { T::DDYFine,                          { Ret::GenericArg0, 1    } },
-        { T::Degrees,                          { Ret::GenericArg0, 1    } },
-        { T::Determinant,                      { Ret::Float,       1    } },
-        { T::DeviceMemoryBarrier,              {                        } },
-        { T::DeviceMemoryBarrierWithGroupSync, {                        } },
-        { T::Distance,                         { Ret::Float,       2    } },
-        { T::Dot,                              { Ret::Float,       2    } }, // float or int with size of input
-        { T::Dst,                              { Ret::GenericArg0, 2    } },
-        { T::ErrorF,                           {                  -1    } },
-        { T::Equal,                            { Ret::Bool,        2    } }, // GLSL only
-        { T::EvaluateAttributeAtCentroid,      { Ret::GenericArg0, 1    } },
-        { T::EvaluateAttributeAtSample,        { Ret::GenericArg0, 2    } },
-        { T::EvaluateAttributeSnapped,         { Ret::GenericArg0, 2    } },
-        { T::Exp,                              { Ret::GenericArg0, 1    } },
-        { T::Exp2,                             { Ret::GenericArg0, 1    } },
-        { T::F16toF32,                         { Ret::Float,       1    } },
-        { T::F32toF16,                         { Ret::UInt,        1    } },
-        { T::FaceForward,                      { Ret::GenericArg0, 3    } },
-        { T::FirstBitHigh,                     { Ret::Int,         1    } },
-        { T::FirstBitLow,                      { Ret::Int,         1    } },
-        { T::Floor,                            { Ret::GenericArg0, 1    } },
-        { T::FMA,                              { Ret::GenericArg0, 3    } },
-        { T::FMod,                             { Ret::GenericArg0, 2    } },
-        { T::Frac,                             { Ret::GenericArg0, 1    } },
-        { T::FrExp,                            { Ret::GenericArg0, 2    } },
-        { T::FWidth,                           { Ret::GenericArg0, 1    } },
-        { T::GetRenderTargetSampleCount,       { Ret::UInt              } },
-        { T::GetRenderTargetSamplePosition,    { Ret::Float2,      1    } },
-        { T::GreaterThan,                      { Ret::Bool,        2    } }, // GLSL only
-        { T::GreaterThanEqual,                 { Ret::Bool,        2    } }, // GLSL only
-        { T::GroupMemoryBarrier,               {                        } },
-        { T::GroupMemoryBarrierWithGroupSync,  {                        } },
-        { T::InterlockedAdd,                   {                   2, 3 } },
-        { T::InterlockedAnd,                   {                   2, 3 } },
-        { T::InterlockedCompareExchange,       {                   4    } },
-        { T::InterlockedCompareStore,          {                   3    } },
-        { T::InterlockedExchange,              {                   3    } },
-        { T::InterlockedMax,                   {                   2, 3 } },
-        { T::InterlockedMin,                   {                   2, 3 } },
-        { T::InterlockedOr,                    {                   2, 3 } },
-        { T::InterlockedXor,                   {                   2, 3 } },
-        { T::IsFinite,                         { Ret::GenericArg0, 1    } }, // bool with size as input
-        { T::IsInf,                            { Ret::GenericArg0, 1    } }, // bool with size as input
-        { T::IsNaN,                            { Ret::GenericArg0, 1    } }, // bool with size as input
-        { T::LdExp,                            { Ret::GenericArg0, 2    } }, // float with size as input
-        { T::Length,                           { Ret::Float,       1    } },
-        { T::Lerp,                             { Ret::GenericArg0, 3    } },
-        { T::LessThan,                         { Ret::Bool,        2    } }, // GLSL only
-        { T::LessThanEqual,                    { Ret::Bool,        2    } }, // GLSL only
-        { T::Lit,                              { Ret::Float4,      3    } },
-        { T::Log,                              { Ret::GenericArg0, 1    } },
-        { T::Log10,                            { Ret::GenericArg0, 1    } },
-        { T::Log2,                             { Ret::GenericArg0, 1    } },
-        { T::MAD,                              { Ret::GenericArg0, 3    } },
-        { T::Max,                              { Ret::GenericArg0, 2    } },
-        { T::Min,                              { Ret::GenericArg0, 2    } },
-        { T::ModF,                             { Ret::GenericArg0, 2    } },
-        { T::MSAD4,                            { Ret::UInt4,       3    } },
-      //{ T::Mul,                              {                        } }, // special case
-        { T::Normalize,                        { Ret::GenericArg0, 1    } },
-        { T::NotEqual,                         { Ret::Bool,        2    } }, // GLSL only
-        { T::Not,                              { Ret::Bool,        1    } }, // GLSL only
-        { T::Pow,                              { Ret::GenericArg0, 2    } },
-        { T::PrintF,                           {                  -1    } },
-        { T::Process2DQuadTessFactorsAvg,      {                   5    } },
-        { T::Process2DQuadTessFactorsMax,      {                   5    } },
-        { T::Process2DQuadTessFactorsMin,      {                   5    } },
-        { T::ProcessIsolineTessFactors,        {                   4    } },
-        { T::ProcessQuadTessFactorsAvg,        {                   5    } },
-        { T::ProcessQuadTessFactorsMax,        {                   5    } },
-        { T::ProcessQuadTessFactorsMin,        {                   5    } },
-        { T::ProcessTriTessFactorsAvg,         {                   5    } },
-        { T::ProcessTriTessFactorsMax,         {                   5    } },
-        { T::ProcessTriTessFactorsMin,         {                   5    } },
-        { T::Radians,                          { Ret::GenericArg0, 1    } },
-        { T::Rcp,                              { Ret::GenericArg0, 1    } },
-        { T::Reflect,                          { Ret::GenericArg0, 2    } },
-        { T::Refract,                          { Ret::GenericArg0, 3    } },
-        { T::ReverseBits,                      { Ret::UInt,        1    } },
-        { T::Round,                            { Ret::GenericArg0, 1    } },
-        { T::RSqrt,                            { Ret::GenericArg0, 1    } },
-        { T::Saturate,                         { Ret::GenericArg0, 1    } },
-        { T::Sign,                             { Ret::GenericArg0, 1    } },
-        { T::Sin,                              { Ret::GenericArg0, 1    } },
-        { T::SinCos,                           {                   3    } },
-        { T::SinH,                             { Ret::GenericArg0, 1    } },
-        { T::SmoothStep,                       { Ret::GenericArg2, 3    } },
-        { T::Sqrt,                             { Ret::GenericArg0, 1    } },
-        { T::Step,                             { Ret::GenericArg0, 2    } },
-        { T::Tan,                              { Ret::GenericArg0, 1    } },
-        { T::TanH,                             { Ret::GenericArg0, 1    } },
-        { T::Tex1D_2,                          { Ret::Float4,      2    } },
-        { T::Tex1D_4,                          { Ret::Float4,      4    } },
-        { T::Tex1DBias,                        { Ret::Float4,      2    } },
-        { T::Tex1DGrad,                        { Ret::Float4,      4    } },
-        { T::Tex1DLod,                         { Ret::Float4,      2    } },
-        { T::Tex1DProj,                        { Ret::Float4,      2    } },
-        { T::Tex2D_2,                          { Ret::Float4,      2    } },
-        { T::Tex2D_4,                          { Ret::Float4,      4    } },
-        { T::Tex2DBias,                        { Ret::Float4,      2    } },
-        { T::Tex2DGrad,                        { Ret::Float4,      4    } },
-        { T::Tex2DLod,                         { Ret::Float4,      2    } },
-        { T::Tex2DProj,                        { Ret::Float4,      2    } },
-        { T::Tex3D_2,                          { Ret::Float4,      2    } },
-        { T::Tex3D_4,                          { Ret::Float4,      4    } },
-        { T::Tex3DBias,                        { Ret::Float4,      2    } },
-        { T::Tex3DGrad,                        { Ret::Float4,      4    } },
-        { T::Tex3DLod,                         { Ret::Float4,      2    } },
-        { T::Tex3DProj,                        { Ret::Float4,      2    } },
-        { T::TexCube_2,                        { Ret::Float4,      2    } },
-        { T::TexCube_4,                        { Ret::Float4,      4    } },
-        { T::TexCubeBias,                      { Ret::Float4,      2    } },
-        { T::TexCubeGrad,                      { Ret::Float4,      4    } },
-        { T::TexCubeLod,                       { Ret::Float4,      2    } },
-        { T::TexCubeProj,                      { Ret::Float4,      2    } },
-      //{ T::Transpose,                        {                        } }, // special case
-        { T::Trunc,                            { Ret::GenericArg0, 1    } },
-
-        { T::Texture_GetDimensions,            {                   3    } },
-        { T::Texture_Load_1,                   { Ret::Float4,      1    } },
-        { T::Texture_Load_2,                   { Ret::Float4,      2    } },
-        { T::Texture_Load_3,                   { Ret::Float4,      3    } },
-        { T::Texture_Gather_2,                 { Ret::Float4,      2    } },
-        { T::Texture_Gather_3,                 { Ret::Float4,      3    } },
-        { T::Texture_Gather_4,                 { Ret::Float4,      4    } },
-        { T::Texture_GatherRed_2,              { Ret::Float4,      2    } },
-        { T::Texture_GatherRed_3,              { Ret::Float4,      3    } },
-        { T::Texture_GatherRed_4,              { Ret::Float4,      4    } },
-        { T::Texture_GatherRed_6,              { Ret::Float4,      6    } },
-        { T::Texture_GatherRed_7,              { Ret::Float4,      7    } },
-        { T::Texture_GatherGreen_2,            { Ret::Float4,      2    } },
-        { T::Texture_GatherGreen_3,            { Ret::Float4,      3    } },
-        { T::Texture_GatherGreen_4,            { Ret::Float4,      4    } },
-        { T::Texture_GatherGreen_6,            { Ret::Float4,      6    } },
-        { T::Texture_GatherGreen_7,            { Ret::Float4,      7    } },
-        { T::Texture_GatherBlue_2,             { Ret::Float4,      2    } },
-        { T::Texture_GatherBlue_3,             { Ret::Float4,      3    } },
-        { T::Texture_GatherBlue_4,             { Ret::Float4,      4    } },
-        { T::Texture_GatherBlue_6,             { Ret::Float4,      6    } },
-        { T::Texture_GatherBlue_7,             { Ret::Float4,      7    } },
-        { T::Texture_GatherAlpha_2,            { Ret::Float4,      2    } },
-        { T::Texture_GatherAlpha_3,            { Ret::Float4,      3    } },
-        { T::Texture_GatherAlpha_4,            { Ret::Float4,      4    } },
-        { T::Texture_GatherAlpha_6,            { Ret::Float4,      6    } },
-        { T::Texture_GatherAlpha_7,            { Ret::Float4,      7    } },
-        { T::Texture_GatherCmp_3,              { Ret::Float4,      3    } },
-        { T::Texture_GatherCmp_4,              { Ret::Float4,      4    } },
-        { T::Texture_GatherCmp_5,              { Ret::Float4,      5    } },
-        { T::Texture_GatherCmpRed_3,           { Ret::Float4,      3    } },
-        { T::Texture_GatherCmpRed_4,           { Ret::Float4,      4    } },
-        { T::Texture_GatherCmpRed_5,           { Ret::Float4,      5    } },
-        { T::Texture_GatherCmpRed_7,           { Ret::Float4,      7    } },
-        { T::Texture_GatherCmpRed_8,           { Ret::Float4,      8    } },
-        { T::Texture_GatherCmpGreen_3,         { Ret::Float4,      3    } },
-        { T::Texture_GatherCmpGreen_4,         { Ret::Float4,      4    } },
-        { T::Texture_GatherCmpGreen_5,         { Ret::Float4,      5    } },
-        { T::Texture_GatherCmpGreen_7,         { Ret::Float4,      7    } },
-        { T::Texture_GatherCmpGreen_8,         { Ret::Float4,      8    } },
-        { T::Texture_GatherCmpBlue_3,          { Ret::Float4,      3    } },
-        { T::Texture_GatherCmpBlue_4,          { Ret::Float4,      4    } },
-        { T::Texture_GatherCmpBlue_5,          { Ret::Float4,      5    } },
-        { T::Texture_GatherCmpBlue_7,          { Ret::Float4,      7    } },
-        { T::Texture_GatherCmpBlue_8,          { Ret::Float4,      8    } },
-        { T::Texture_GatherCmpAlpha_3,         { Ret::Float4,      3    } },
-        { T::Texture_GatherCmpAlpha_4,         { Ret::Float4,      4    } },
-        { T::Texture_GatherCmpAlpha_5,         { Ret::Float4,      5    } },
-        { T::Texture_GatherCmpAlpha_7,         { Ret::Float4,      7    } },
-        { T::Texture_GatherCmpAlpha_8,         { Ret::Float4,      8    } },
-        { T::Texture_Sample_2,                 { Ret::Float4,      2    } },
-        { T::Texture_Sample_3,                 { Ret::Float4,      3    } },
-        { T::Texture_Sample_4,                 { Ret::Float4,      4    } },
-        { T::Texture_Sample_5,                 { Ret::Float4,      5    } },
-        { T::Texture_SampleBias_3,             { Ret::Float4,      3    } },
-        { T::Texture_SampleBias_4,             { Ret::Float4,      4    } },
-        { T::Texture_SampleBias_5,             { Ret::Float4,      5    } },
-        { T::Texture_SampleBias_6,             { Ret::Float4,      6    } },
-        { T::Texture_SampleCmp_3,              { Ret::Float,       3    } },
-        { T::Texture_SampleCmp_4,              { Ret::Float,       4    } },
-        { T::Texture_SampleCmp_5,              { Ret::Float,       5    } },
-        { T::Texture_SampleCmp_6,              { Ret::Float,       6    } },
-        { T::Texture_SampleGrad_4,             { Ret::Float4,      4    } },
-        { T::Texture_SampleGrad_5,             { Ret::Float4,      5    } },
-        { T::Texture_SampleGrad_6,             { Ret::Float4,      6    } },
-        { T::Texture_SampleGrad_7,             { Ret::Float4,      7    } },
-        { T::Texture_SampleLevel_3,            { Ret::Float4,      3    } },
-        { T::Texture_SampleLevel_4,            { Ret::Float4,      4    } },
-        { T::Texture_SampleLevel_5,            { Ret::Float4,      5    } },
-        { T::Texture_QueryLod,                 { Ret::Float,       2    } },
-        { T::Texture_QueryLodUnclamped,        { Ret::Float,       2    } },
-
-        { T::StreamOutput_Append,              {                   1    } },
-        { T::StreamOutput_RestartStrip,        {                        } },
-
-        { T::Image_Load,                       { Ret::Float4,      2    } },
-        { T::Image_Store,                      {                   3    } },
-        { T::Image_AtomicAdd,                  {                   2, 3 } },
-        { T::Image_AtomicAnd,                  {                   2, 3 } },
-        { T::Image_AtomicCompSwap,             {                   4    } },
-        { T::Image_AtomicExchange,             {                   3    } },
-        { T::Image_AtomicMax,                  {                   2, 3 } },
-        { T::Image_AtomicMin,                  {                   2, 3 } },
-        { T::Image_AtomicOr,                   {                   2, 3 } },
-        { T::Image_AtomicXor,                  {                   2, 3 } },
+        { T::Abort,                            {                                         } },
+        { T::Abs,                              { Ret::GenericArg0, 1                     } },
+        { T::ACos,                             { Ret::GenericArg0, 1, Par::Float         } },
+        { T::All,                              { Ret::Bool,        1                     } },
+        { T::AllMemoryBarrier,                 {                                         } },
+        { T::AllMemoryBarrierWithGroupSync,    {                                         } },
+        { T::Any,                              { Ret::Bool,        1                     } },
+        { T::AsDouble,                         { Ret::Double,      2                     } },
+        { T::AsFloat,                          { Ret::GenericArg0, 1                     } },
+        { T::ASin,                             { Ret::GenericArg0, 1, Par::Float         } },
+        { T::AsInt,                            { Ret::GenericArg0, 1                     } },
+        { T::AsUInt_1,                         { Ret::GenericArg0, 1                     } },
+        { T::AsUInt_3,                         {                   3                     } },
+        { T::ATan,                             { Ret::GenericArg0, 1, Par::Float         } },
+        { T::ATan2,                            { Ret::GenericArg1, 2, Par::Float         } },
+        { T::Ceil,                             { Ret::GenericArg0, 1, Par::Float         } },
+        { T::CheckAccessFullyMapped,           { Ret::Bool,        1                     } },
+        { T::Clamp,                            { Ret::GenericArg0, 3                     } },
+        { T::Clip,                             {                   1                     } },
+        { T::Cos,                              { Ret::GenericArg0, 1, Par::Float         } },
+        { T::CosH,                             { Ret::GenericArg0, 1, Par::Float         } },
+        { T::CountBits,                        { Ret::UInt,        1                     } },
+        { T::Cross,                            { Ret::Float3,      2, Par::Float         } },
+        { T::D3DCOLORtoUBYTE4,                 { Ret::Int4,        1                     } },
+        { T::DDX,                              { Ret::GenericArg0, 1, Par::Float         } },
+        { T::DDXCoarse,                        { Ret::GenericArg0, 1, Par::Float         } },
+        { T::DDXFine,                          { Ret::GenericArg0, 1, Par::Float         } },
+        { T::DDY,                              { Ret::GenericArg0, 1, Par::Float         } },
+        { T::DDYCoarse,                        { Ret::GenericArg0, 1, Par::Float         } },
+        { T::DDYFine,                          { Ret::GenericArg0, 1, Par::Float         } },
+        { T::Degrees,                          { Ret::GenericArg0, 1, Par::Float         } },
+        { T::Determinant,                      { Ret::Float,       1, Par::Float         } },
+        { T::DeviceMemoryBarrier,              {                                         } },
+        { T::DeviceMemoryBarrierWithGroupSync, {                                         } },
+        { T::Distance,                         { Ret::Float,       2, Par::Float         } },
+        { T::Dot,                              { Ret::Float,       2, Par::GenericMinDim } }, // float or int with size of input
+        { T::Dst,                              { Ret::GenericArg0, 2, Par::Float         } },
+        { T::ErrorF,                           {                   -1                    } },
+        { T::Equal,                            { Ret::Bool,        2                     } }, // GLSL only
+        { T::EvaluateAttributeAtCentroid,      { Ret::GenericArg0, 1                     } },
+        { T::EvaluateAttributeAtSample,        { Ret::GenericArg0, 2                     } },
+        { T::EvaluateAttributeSnapped,         { Ret::GenericArg0, 2                     } },
+        { T::Exp,                              { Ret::GenericArg0, 1, Par::Float         } },
+        { T::Exp2,                             { Ret::GenericArg0, 1, Par::Float         } },
+        { T::F16toF32,                         { Ret::Float,       1                     } },
+        { T::F32toF16,                         { Ret::UInt,        1                     } },
+        { T::FaceForward,                      { Ret::GenericArg0, 3, Par::Float         } },
+        { T::FirstBitHigh,                     { Ret::Int,         1                     } },
+        { T::FirstBitLow,                      { Ret::Int,         1                     } },
+        { T::Floor,                            { Ret::GenericArg0, 1, Par::Float         } },
+        { T::FMA,                              { Ret::GenericArg0, 3                     } },
+        { T::FMod,                             { Ret::GenericArg0, 2, Par::Float         } },
+        { T::Frac,                             { Ret::GenericArg0, 1, Par::Float         } },
+        { T::FrExp,                            { Ret::GenericArg0, 2, Par::Float         } },
+        { T::FWidth,                           { Ret::GenericArg0, 1, Par::Float         } },
+        { T::GetRenderTargetSampleCount,       { Ret::UInt,                              } },
+        { T::GetRenderTargetSamplePosition,    { Ret::Float2,      1                     } },
+        { T::GreaterThan,                      { Ret::Bool,        2                     } }, // GLSL only
+        { T::GreaterThanEqual,                 { Ret::Bool,        2                     } }, // GLSL only
+        { T::GroupMemoryBarrier,               {                                         } },
+        { T::GroupMemoryBarrierWithGroupSync,  {                                         } },
+        { T::InterlockedAdd,                   {                   2, 3                  } },
+        { T::InterlockedAnd,                   {                   2, 3                  } },
+        { T::InterlockedCompareExchange,       {                   4                     } },
+        { T::InterlockedCompareStore,          {                   3                     } },
+        { T::InterlockedExchange,              {                   3                     } },
+        { T::InterlockedMax,                   {                   2, 3                  } },
+        { T::InterlockedMin,                   {                   2, 3                  } },
+        { T::InterlockedOr,                    {                   2, 3                  } },
+        { T::InterlockedXor,                   {                   2, 3                  } },
+        { T::IsFinite,                         { Ret::GenericArg0, 1                     } }, // bool with size as input
+        { T::IsInf,                            { Ret::GenericArg0, 1                     } }, // bool with size as input
+        { T::IsNaN,                            { Ret::GenericArg0, 1                     } }, // bool with size as input
+        { T::LdExp,                            { Ret::GenericArg0, 2, Par::Float         } }, // float with size as input
+        { T::Length,                           { Ret::Float,       1, Par::Float         } },
+        { T::Lerp,                             { Ret::GenericArg0, 3, Par::Float         } },
+        { T::LessThan,                         { Ret::Bool,        2                     } }, // GLSL only
+        { T::LessThanEqual,                    { Ret::Bool,        2                     } }, // GLSL only
+        { T::Lit,                              { Ret::Float4,      3, Par::Float         } },
+        { T::Log,                              { Ret::GenericArg0, 1, Par::Float         } },
+        { T::Log10,                            { Ret::GenericArg0, 1, Par::Float         } },
+        { T::Log2,                             { Ret::GenericArg0, 1, Par::Float         } },
+        { T::MAD,                              { Ret::GenericArg0, 3                     } },
+        { T::Max,                              { Ret::GenericArg0, 2                     } },
+        { T::Min,                              { Ret::GenericArg0, 2                     } },
+        { T::ModF,                             { Ret::GenericArg0, 2                     } },
+        { T::MSAD4,                            { Ret::UInt4,       3                     } },
+      //{ T::Mul,                              {                                         } }, // special case
+        { T::Normalize,                        { Ret::GenericArg0, 1, Par::Float         } },
+        { T::NotEqual,                         { Ret::Bool,        2                     } }, // GLSL only
+        { T::Not,                              { Ret::Bool,        1                     } }, // GLSL only
+        { T::Pow,                              { Ret::GenericArg0, 2, Par::Float         } },
+        { T::PrintF,                           {                   -1                    } },
+        { T::Process2DQuadTessFactorsAvg,      {                   5                     } },
+        { T::Process2DQuadTessFactorsMax,      {                   5                     } },
+        { T::Process2DQuadTessFactorsMin,      {                   5                     } },
+        { T::ProcessIsolineTessFactors,        {                   4                     } },
+        { T::ProcessQuadTessFactorsAvg,        {                   5                     } },
+        { T::ProcessQuadTessFactorsMax,        {                   5                     } },
+        { T::ProcessQuadTessFactorsMin,        {                   5                     } },
+        { T::ProcessTriTessFactorsAvg,         {                   5                     } },
+        { T::ProcessTriTessFactorsMax,         {                   5                     } },
+        { T::ProcessTriTessFactorsMin,         {                   5                     } },
+        { T::Radians,                          { Ret::GenericArg0, 1, Par::Float         } },
+        { T::Rcp,                              { Ret::GenericArg0, 1                     } },
+        { T::Reflect,                          { Ret::GenericArg0, 2, Par::Float         } },
+        { T::Refract,                          { Ret::GenericArg0, 3, Par::Float         } },
+        { T::ReverseBits,                      { Ret::UInt,        1                     } },
+        { T::Round,                            { Ret::GenericArg0, 1, Par::Float         } },
+        { T::RSqrt,                            { Ret::GenericArg0, 1, Par::Float         } },
+        { T::Saturate,                         { Ret::GenericArg0, 1, Par::Float         } },
+        { T::Sign,                             { Ret::GenericArg0, 1                     } },
+        { T::Sin,                              { Ret::GenericArg0, 1, Par::Float         } },
+        { T::SinCos,                           { Ret::Void,        3, Par::Float         } },
+        { T::SinH,                             { Ret::GenericArg0, 1, Par::Float         } },
+        { T::SmoothStep,                       { Ret::GenericArg2, 3, Par::Float         } },
+        { T::Sqrt,                             { Ret::GenericArg0, 1, Par::Float         } },
+        { T::Step,                             { Ret::GenericArg0, 2, Par::Float         } },
+        { T::Tan,                              { Ret::GenericArg0, 1, Par::Float         } },
+        { T::TanH,                             { Ret::GenericArg0, 1, Par::Float         } },
+        { T::Tex1D_2,                          { Ret::Float4,      2                     } },
+        { T::Tex1D_4,                          { Ret::Float4,      4                     } },
+        { T::Tex1DBias,                        { Ret::Float4,      2                     } },
+        { T::Tex1DGrad,                        { Ret::Float4,      4                     } },
+        { T::Tex1DLod,                         { Ret::Float4,      2                     } },
+        { T::Tex1DProj,                        { Ret::Float4,      2                     } },
+        { T::Tex2D_2,                          { Ret::Float4,      2                     } },
+        { T::Tex2D_4,                          { Ret::Float4,      4                     } },
+        { T::Tex2DBias,                        { Ret::Float4,      2                     } },
+        { T::Tex2DGrad,                        { Ret::Float4,      4                     } },
+        { T::Tex2DLod,                         { Ret::Float4,      2                     } },
+        { T::Tex2DProj,                        { Ret::Float4,      2                     } },
+        { T::Tex3D_2,                          { Ret::Float4,      2                     } },
+        { T::Tex3D_4,                          { Ret::Float4,      4                     } },
+        { T::Tex3DBias,                        { Ret::Float4,      2                     } },
+        { T::Tex3DGrad,                        { Ret::Float4,      4                     } },
+        { T::Tex3DLod,                         { Ret::Float4,      2                     } },
+        { T::Tex3DProj,                        { Ret::Float4,      2                     } },
+        { T::TexCube_2,                        { Ret::Float4,      2                     } },
+        { T::TexCube_4,                        { Ret::Float4,      4                     } },
+        { T::TexCubeBias,                      { Ret::Float4,      2                     } },
+        { T::TexCubeGrad,                      { Ret::Float4,      4                     } },
+        { T::TexCubeLod,                       { Ret::Float4,      2                     } },
+        { T::TexCubeProj,                      { Ret::Float4,      2                     } },
+      //{ T::Transpose,                        {                                         } }, // special case
+        { T::Trunc,                            { Ret::GenericArg0, 1, Par::Float         } },
+
+        { T::Texture_GetDimensions,            {                   3                     } },
+        { T::Texture_Load_1,                   { Ret::Float4,      1                     } },
+        { T::Texture_Load_2,                   { Ret::Float4,      2                     } },
+        { T::Texture_Load_3,                   { Ret::Float4,      3                     } },
+        { T::Texture_Gather_2,                 { Ret::Float4,      2                     } },
+        { T::Texture_Gather_3,                 { Ret::Float4,      3                     } },
+        { T::Texture_Gather_4,                 { Ret::Float4,      4                     } },
+        { T::Texture_GatherRed_2,              { Ret::Float4,      2                     } },
+        { T::Texture_GatherRed_3,              { Ret::Float4,      3                     } },
+        { T::Texture_GatherRed_4,              { Ret::Float4,      4                     } },
+        { T::Texture_GatherRed_6,              { Ret::Float4,      6                     } },
+        { T::Texture_GatherRed_7,              { Ret::Float4,      7                     } },
+        { T::Texture_GatherGreen_2,            { Ret::Float4,      2                     } },
+        { T::Texture_GatherGreen_3,            { Ret::Float4,      3                     } },
+        { T::Texture_GatherGreen_4,            { Ret::Float4,      4                     } },
+        { T::Texture_GatherGreen_6,            { Ret::Float4,      6                     } },
+        { T::Texture_GatherGreen_7,            { Ret::Float4,      7                     } },
+        { T::Texture_GatherBlue_2,             { Ret::Float4,      2                     } },
+        { T::Texture_GatherBlue_3,             { Ret::Float4,      3                     } },
+        { T::Texture_GatherBlue_4,             { Ret::Float4,      4                     } },
+        { T::Texture_GatherBlue_6,             { Ret::Float4,      6                     } },
+        { T::Texture_GatherBlue_7,             { Ret::Float4,      7                     } },
+        { T::Texture_GatherAlpha_2,            { Ret::Float4,      2                     } },
+        { T::Texture_GatherAlpha_3,            { Ret::Float4,      3                     } },
+        { T::Texture_GatherAlpha_4,            { Ret::Float4,      4                     } },
+        { T::Texture_GatherAlpha_6,            { Ret::Float4,      6                     } },
+        { T::Texture_GatherAlpha_7,            { Ret::Float4,      7                     } },
+        { T::Texture_GatherCmp_3,              { Ret::Float4,      3                     } },
+        { T::Texture_GatherCmp_4,              { Ret::Float4,      4                     } },
+        { T::Texture_GatherCmp_5,              { Ret::Float4,      5                     } },
+        { T::Texture_GatherCmpRed_3,           { Ret::Float4,      3                     } },
+        { T::Texture_GatherCmpRed_4,           { Ret::Float4,      4                     } },
+        { T::Texture_GatherCmpRed_5,           { Ret::Float4,      5                     } },
+        { T::Texture_GatherCmpRed_7,           { Ret::Float4,      7                     } },
+        { T::Texture_GatherCmpRed_8,           { Ret::Float4,      8                     } },
+        { T::Texture_GatherCmpGreen_3,         { Ret::Float4,      3                     } },
+        { T::Texture_GatherCmpGreen_4,         { Ret::Float4,      4                     } },
+        { T::Texture_GatherCmpGreen_5,         { Ret::Float4,      5                     } },
+        { T::Texture_GatherCmpGreen_7,         { Ret::Float4,      7                     } },
+        { T::Texture_GatherCmpGreen_8,         { Ret::Float4,      8                     } },
+        { T::Texture_GatherCmpBlue_3,          { Ret::Float4,      3                     } },
+        { T::Texture_GatherCmpBlue_4,          { Ret::Float4,      4                     } },
+        { T::Texture_GatherCmpBlue_5,          { Ret::Float4,      5                     } },
+        { T::Texture_GatherCmpBlue_7,          { Ret::Float4,      7                     } },
+        { T::Texture_GatherCmpBlue_8,          { Ret::Float4,      8                     } },
+        { T::Texture_GatherCmpAlpha_3,         { Ret::Float4,      3                     } },
+        { T::Texture_GatherCmpAlpha_4,         { Ret::Float4,      4                     } },
+        { T::Texture_GatherCmpAlpha_5,         { Ret::Float4,      5                     } },
+        { T::Texture_GatherCmpAlpha_7,         { Ret::Float4,      7                     } },
+        { T::Texture_GatherCmpAlpha_8,         { Ret::Float4,      8                     } },
+        { T::Texture_Sample_2,                 { Ret::Float4,      2                     } },
+        { T::Texture_Sample_3,                 { Ret::Float4,      3                     } },
+        { T::Texture_Sample_4,                 { Ret::Float4,      4                     } },
+        { T::Texture_Sample_5,                 { Ret::Float4,      5                     } },
+        { T::Texture_SampleBias_3,             { Ret::Float4,      3                     } },
+        { T::Texture_SampleBias_4,             { Ret::Float4,      4                     } },
+        { T::Texture_SampleBias_5,             { Ret::Float4,      5                     } },
+        { T::Texture_SampleBias_6,             { Ret::Float4,      6                     } },
+        { T::Texture_SampleCmp_3,              { Ret::Float,       3                     } },
+        { T::Texture_SampleCmp_4,              { Ret::Float,       4                     } },
+        { T::Texture_SampleCmp_5,              { Ret::Float,       5                     } },
+        { T::Texture_SampleCmp_6,              { Ret::Float,       6                     } },
+        { T::Texture_SampleGrad_4,             { Ret::Float4,      4                     } },
+        { T::Texture_SampleGrad_5,             { Ret::Float4,      5                     } },
+        { T::Texture_SampleGrad_6,             { Ret::Float4,      6                     } },
+        { T::Texture_SampleGrad_7,             { Ret::Float4,      7                     } },
+        { T::Texture_SampleLevel_3,            { Ret::Float4,      3                     } },
+        { T::Texture_SampleLevel_4,            { Ret::Float4,      4                     } },
+        { T::Texture_SampleLevel_5,            { Ret::Float4,      5                     } },
+        { T::Texture_QueryLod,                 { Ret::Float,       2                     } },
+        { T::Texture_QueryLodUnclamped,        { Ret::Float,       2                     } },
+
+        { T::StreamOutput_Append,              {                   1                     } },
+        { T::StreamOutput_RestartStrip,        {                                         } },
+
+        { T::Image_Load,                       { Ret::Float4,      2                     } },
+        { T::Image_Store,                      {                   3                     } },
+        { T::Image_AtomicAdd,                  {                   2, 3                  } },
+        { T::Image_AtomicAnd,                  {                   2, 3                  } },
+        { T::Image_AtomicCompSwap,             {                   4                     } },
+        { T::Image_AtomicExchange,             {                   3                     } },
+        { T::Image_AtomicMax,                  {                   2, 3                  } },
+        { T::Image_AtomicMin,                  {                   2, 3                  } },
+        { T::Image_AtomicOr,                   {                   2, 3                  } },
+        { T::Image_AtomicXor,                  {                   2, 3                  } },
     };
+
+    std::vector<IntrinsicSignature> table(NUM_INTRINSICS);
+
+    for (const auto& entry : signatures)
+    {
+        auto& signature = table[INTRINSIC_IDX(entry.first)];
+        signature = entry.second;
+
+        /* Create canonical type denoter for fixed return types */
+        if (signature.returnType == Ret::Void)
+            signature.returnTypeDenoter = VoidTypeDenoter::GetCanonical();
+        else
+        {
+            const auto returnTypeFixed = IntrinsicReturnTypeToDataType(signature.returnType);
+            if (returnTypeFixed != DataType::Undefined)
+                signature.returnTypeDenoter = BaseTypeDenoter::GetCanonical(returnTypeFixed);
+        }
+    }
+
+    return table;
 }
 
-static const auto g_intrinsicSignatureMap = GenerateIntrinsicSignatureMap();
+static const auto g_intrinsicSignatureTable = GenerateIntrinsicSignatureTable();
+
+// Returns the signature of the specified intrinsic, or null if there is no signature (e.g. for special cases like 'mul').
+static const IntrinsicSignature* FindIntrinsicSignature(const Intrinsic intrinsic)
+{
+    const auto idx = INTRINSIC_IDX(intrinsic);
+    if (idx < g_intrinsicSignatureTable.size() && g_intrinsicSignatureTable[idx].valid)
+        return &(g_intrinsicSignatureTable[idx]);
+    else
+        return nullptr;
+}
 
 
 /* ----- HLSLIntrinsicAdept class ----- */
@@ -631,9 +718,6 @@ std::vector<TypeDenoterPtr> HLSLIntrinsicAdept::GetIntrinsicParameterTypes(const
 
     switch (intrinsic)
     {
-        case Intrinsic::Dot:
-            DeriveParameterTypes(paramTypeDenoters, intrinsic, args, true);
-            break;
         case Intrinsic::Mul:
             DeriveParameterTypesMul(paramTypeDenoters, args);
             break;
@@ -693,10 +777,9 @@ const HLSLIntrinsicsMap& HLSLIntrinsicAdept::GetIntrinsicMap()
 
 TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnType(const Intrinsic intrinsic, const std::vector<ExprPtr>& args) const
 {
-    /* Get type denoter from intrinsic signature map */
-    auto it = g_intrinsicSignatureMap.find(intrinsic);
-    if (it != g_intrinsicSignatureMap.end())
-        return it->second.GetTypeDenoterWithArgs(args);
+    /* Get type denoter from intrinsic signature table */
+    if (auto signature = FindIntrinsicSignature(intrinsic))
+        return signature->GetTypeDenoterWithArgs(args);
     else
         RuntimeErr(R_FailedToDeriveIntrinsicType(GetIntrinsicIdent(intrinsic)));
 }
@@ -721,7 +804,7 @@ TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeMul(const std::vector<ExprPtr
         if (type1->IsVector())
         {
             auto baseDataType0 = BaseDataType(static_cast<BaseTypeDenoter&>(*type0).dataType);
-            return std::make_shared<BaseTypeDenoter>(baseDataType0); // scalar
+            return BaseTypeDenoter::GetCanonical(baseDataType0); // scalar
         }
 
         if (type1->IsMatrix())
@@ -729,7 +812,7 @@ TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeMul(const std::vector<ExprPtr
             auto dataType1      = static_cast<BaseTypeDenoter&>(*type1).dataType;
             auto baseDataType1  = BaseDataType(dataType1);
             auto matrixTypeDim1 = MatrixTypeDim(dataType1);
-            return std::make_shared<BaseTypeDenoter>(VectorDataType(baseDataType1, matrixTypeDim1.second));
+            return BaseTypeDenoter::GetCanonical(VectorDataType(baseDataType1, matrixTypeDim1.second));
         }
     }
 
@@ -743,7 +826,7 @@ TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeMul(const std::vector<ExprPtr
             auto dataType0      = static_cast<BaseTypeDenoter&>(*type0).dataType;
             auto baseDataType0  = BaseDataType(dataType0);
             auto matrixTypeDim0 = MatrixTypeDim(dataType0);
-            return std::make_shared<BaseTypeDenoter>(VectorDataType(baseDataType0, matrixTypeDim0.first));
+            return BaseTypeDenoter::GetCanonical(VectorDataType(baseDataType0, matrixTypeDim0.first));
         }
 
         if (type1->IsMatrix())
@@ -753,7 +836,7 @@ TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeMul(const std::vector<ExprPtr
             auto matrixTypeDim0 = MatrixTypeDim(dataType0);
             auto dataType1      = static_cast<BaseTypeDenoter&>(*type1).dataType;
             auto matrixTypeDim1 = MatrixTypeDim(dataType1);
-            return std::make_shared<BaseTypeDenoter>(MatrixDataType(baseDataType0, matrixTypeDim0.first, matrixTypeDim1.second));
+            return BaseTypeDenoter::GetCanonical(MatrixDataType(baseDataType0, matrixTypeDim0.first, matrixTypeDim1.second));
         }
     }
 
@@ -774,7 +857,7 @@ TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeTranspose(const std::vector<E
         auto arg0DataType       = static_cast<const BaseTypeDenoter&>(arg0TypeDen).dataType;
         auto arg0BaseDataType   = BaseDataType(arg0DataType);
         auto arg0MatrixTypeDim  = MatrixTypeDim(arg0DataType);
-        return std::make_shared<BaseTypeDenoter>(MatrixDataType(arg0BaseDataType, arg0MatrixTypeDim.second, arg0MatrixTypeDim.first));
+        return BaseTypeDenoter::GetCanonical(MatrixDataType(arg0BaseDataType, arg0MatrixTypeDim.second, arg0MatrixTypeDim.first));
     }
 
     RuntimeErr(R_InvalidIntrinsicArgs("transpose"));
@@ -791,28 +874,26 @@ TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeVectorCompare(const std::vect
     if (auto arg0BaseTypeDen = arg0TypeDen->As<BaseTypeDenoter>())
     {
         const auto vecTypeSize = VectorTypeDim(arg0BaseTypeDen->dataType);
-        return std::make_shared<BaseTypeDenoter>(VectorDataType(DataType::Bool, vecTypeSize));
+        return BaseTypeDenoter::GetCanonical(VectorDataType(DataType::Bool, vecTypeSize));
     }
 
     return arg0TypeDen;
 }
 
 /*
-TODO:
-This is a temporary solution to derive parameter types of intrinsic.
-Currently all global intrinsics use a common type denoter for all parameters.
+All global intrinsics use a common type denoter for all parameters,
+which is converted according to the parameter types of the intrinsic signature.
 */
 void HLSLIntrinsicAdept::DeriveParameterTypes(
-    std::vector<TypeDenoterPtr>& paramTypeDenoters, const Intrinsic intrinsic, const std::vector<ExprPtr>& args, bool useMinDimension) const
+    std::vector<TypeDenoterPtr>& paramTypeDenoters, const Intrinsic intrinsic, const std::vector<ExprPtr>& args) const
 {
-    /* Get type denoter from intrinsic signature map */
-    auto it = g_intrinsicSignatureMap.find(intrinsic);
-    if (it != g_intrinsicSignatureMap.end())
+    /* Get type denoter from intrinsic signature table */
+    if (auto signature = FindIntrinsicSignature(intrinsic))
     {
         if (!args.empty() && IsGlobalIntrinsic(intrinsic))
         {
             /* Find common type denoter for all arguments */
-            auto commonTypeDenoter = DeriveCommonTypeDenoter(0, args, useMinDimension);
+            auto commonTypeDenoter = signature->GetParamTypeDenoterWithArgs(args);
 
             /* Add parameter type denoter */
             paramTypeDenoters.resize(args.size());
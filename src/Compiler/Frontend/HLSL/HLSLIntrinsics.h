@@ -62,8 +62,7 @@ class HLSLIntrinsicAdept : public IntrinsicAdept
         void DeriveParameterTypes(
             std::vector<TypeDenoterPtr>& paramTypeDenoters,
             const Intrinsic intrinsic,
-            const std::vector<ExprPtr>& args,
-            bool useMinDimension = false
+            const std::vector<ExprPtr>& args
         ) const;
 
         #if 1//TODO: not implemented yet!
@@ -905,6 +905,9 @@ static std::map<std::string, AttributeType> GenerateAttributeTypeMap()
         { "partitioning",              T::Partitioning              },
         { "patchsize",                 T::PatchSize                 },
         { "patchconstantfunc",         T::PatchConstantFunc         },
+
+        { "vk::constant_id",           T::ConstantId                },
+        { "vk::push_constant",         T::PushConstant              },
     };
 }
 
@@ -181,7 +181,7 @@ void HLSLParser::ProcessDirectiveLine()
 
     /* Set new line number and filename */
     auto currentLine = static_cast<int>(GetScanner().PreviousToken()->Pos().Row());
-    GetScanner().Source()->NextSourceOrigin(filename, (lineNo - currentLine - 1));
+    GetScanner().NextSourceOrigin(filename, (lineNo - currentLine - 1));
 }
 
 void HLSLParser::ProcessDirectivePragma()
@@ -384,6 +384,14 @@ AttributePtr HLSLParser::ParseAttribute()
     auto ast = Make<Attribute>();
 
     auto attribIdent = ParseIdent();
+
+    /* Parse optional attribute namespace (e.g. "vk::constant_id") */
+    if (Is(Tokens::DColon))
+    {
+        AcceptIt();
+        attribIdent += "::" + ParseIdent();
+    }
+
     ast->attributeType = HLSLKeywordToAttributeType(attribIdent);
 
     UpdateSourceArea(ast);
@@ -1111,6 +1119,9 @@ StmntPtr HLSLParser::ParseStmntWithStructDecl()
         /* Parse variable declaration with previous structure type */
         auto varDeclStmnt = Make<VarDeclStmnt>();
 
+        /* Reset reference to the structure declaration statement, which is discarded */
+        ast->structDecl->declStmntRef = nullptr;
+
         varDeclStmnt->typeSpecifier = ASTFactory::MakeTypeSpecifier(ast->structDecl);
         
         /* Parse variable declarations */
@@ -2676,7 +2687,7 @@ bool HLSLParser::ParseModifiers(TypeSpecifier* typeSpecifier, bool allowPrimitiv
     else if (Is(Tokens::InterpModifier))
     {
         /* Parse interpolation modifier */
-        typeSpecifier->interpModifiers.insert(ParseInterpModifier());
+        typeSpecifier->interpModifiers.Insert(ParseInterpModifier());
     }
     else if (Is(Tokens::TypeModifier))
     {
@@ -2686,7 +2697,7 @@ bool HLSLParser::ParseModifiers(TypeSpecifier* typeSpecifier, bool allowPrimitiv
     else if (Is(Tokens::StorageClass))
     {
         /* Parse storage class */
-        typeSpecifier->storageClasses.insert(ParseStorageClass());
+        typeSpecifier->storageClasses.Insert(ParseStorageClass());
     }
     else if (Is(Tokens::PrimitiveType))
     {
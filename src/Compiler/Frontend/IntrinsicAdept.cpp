@@ -15,7 +15,8 @@ namespace Xsc
 {
 
 
-static IntrinsicAdept* g_intrinsicAdeptInstance = nullptr;
+// The active intrinsic adept is stored per thread, so that multiple shaders can be compiled in parallel.
+static thread_local IntrinsicAdept* g_intrinsicAdeptInstance = nullptr;
 
 IntrinsicAdept::IntrinsicAdept()
 {
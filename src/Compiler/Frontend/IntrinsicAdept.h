@@ -20,9 +20,6 @@ namespace Xsc
 {
 
 
-// Converts the Intrinsic enum value into a zero-based integral.
-#define INTRINSIC_IDX(I) (static_cast<std::size_t>(I) - static_cast<std::size_t>(Intrinsic::Abort))
-
 // Base class for intrinsic type analysis.
 class IntrinsicAdept
 {
@@ -110,6 +110,11 @@ void Parser::EnableWarnings(bool enable)
     enableWarnings_ = enable;
 }
 
+bool Parser::WarnEnabled() const
+{
+    return enableWarnings_;
+}
+
 /* ----- Scanner ----- */
 
 void Parser::PushScannerSource(const SourceCodePtr& source, const std::string& filename)
@@ -67,6 +67,9 @@ class Parser
 
         void EnableWarnings(bool enable);
 
+        // Returns true if warnings are enabled. Callers can check this before a warning message is constructed.
+        bool WarnEnabled() const;
+
         /* ----- Scanner ----- */
 
         virtual ScannerPtr MakeScanner() = 0;
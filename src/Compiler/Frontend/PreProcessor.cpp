@@ -12,6 +12,8 @@
 #include "Helper.h"
 #include "ReportIdents.h"
 #include <sstream>
+#include <algorithm>
+#include <map>
 
 
 namespace Xsc
@@ -25,17 +27,41 @@ PreProcessor::PreProcessor(IncludeHandler& includeHandler, Log* log) :
 }
 
 std::unique_ptr<std::iostream> PreProcessor::Process(
-    const SourceCodePtr& input, const std::string& filename, bool writeLineMarks, bool enableWarnings)
+    const SourceCodePtr&                    input,
+    const std::string&                      filename,
+    bool                                    writeLineMarks,
+    bool                                    enableWarnings,
+    const std::vector<PredefinedMacro>&     predefinedMacros,
+    const Snapshot*                         snapshot,
+    std::unique_ptr<std::iostream>          output)
 {
-    output_         = MakeUnique<std::stringstream>();
+    output_         = (output ? std::move(output) : MakeUnique<std::stringstream>());
     writeLineMarks_ = writeLineMarks;
 
     EnableWarnings(enableWarnings);
 
+    if (snapshot)
+    {
+        /* Continue with the state and output of the snapshot */
+        macros_             = snapshot->macros;
+        onceIncluded_       = snapshot->onceIncluded;
+        includedFiles_      = snapshot->includedFiles;
+        conditionMacros_    = snapshot->conditionMacros;
+        macroExpansions_    = snapshot->macroExpansions;
+        sources_            = snapshot->sources;
+
+        *output_ << snapshot->output;
+        if (!snapshot->output.empty() && snapshot->output.back() != '\n')
+            *output_ << std::endl;
+    }
+
     PushScannerSource(input, filename);
 
     try
     {
+        for (const auto& macro : predefinedMacros)
+            DefinePredefinedMacro(macro);
+
         ParseProgram();
         return (GetReportHandler().HasErros() ? nullptr : std::move(output_));
     }
@@ -48,6 +74,21 @@ std::unique_ptr<std::iostream> PreProcessor::Process(
     return nullptr;
 }
 
+PreProcessor::Snapshot PreProcessor::MakeSnapshot(const std::string& output) const
+{
+    Snapshot snapshot;
+    {
+        snapshot.macros             = macros_;
+        snapshot.onceIncluded       = onceIncluded_;
+        snapshot.includedFiles      = includedFiles_;
+        snapshot.conditionMacros    = conditionMacros_;
+        snapshot.macroExpansions    = macroExpansions_;
+        snapshot.sources            = sources_;
+        snapshot.output             = output;
+    }
+    return snapshot;
+}
+
 std::vector<std::string> PreProcessor::ListDefinedMacroIdents() const
 {
     std::vector<std::string> idents;
@@ -59,6 +100,142 @@ std::vector<std::string> PreProcessor::ListDefinedMacroIdents() const
     return idents;
 }
 
+// Returns the filename and the row of the specified source position with its source origin (see SourcePosition::ToString).
+static bool GetSourceLocation(const SourcePosition& pos, std::string& filename, unsigned int& row)
+{
+    if (!pos.IsValid())
+        return false;
+
+    if (auto origin = pos.GetOrigin())
+    {
+        filename    = origin->filename;
+        row         = static_cast<unsigned int>(static_cast<int>(pos.Row()) + origin->lineOffset);
+    }
+    else
+    {
+        filename.clear();
+        row = pos.Row();
+    }
+
+    return true;
+}
+
+std::vector<std::string> PreProcessor::ListRelevantMacroIdents(const Program& program) const
+{
+    /*
+    Determine the first row of each global statement (including its attributes and type specifier) per source file.
+    Each global statement covers all rows until the next global statement of the same source file.
+    */
+    struct GlobalStmntRows
+    {
+        unsigned int    firstRow;
+        bool            reachable;
+    };
+
+    std::map<std::string, std::vector<GlobalStmntRows>> globalStmntRows;
+
+    for (const auto& stmnt : program.globalStmnts)
+    {
+        std::string filename;
+        unsigned int firstRow = 0;
+
+        if (!GetSourceLocation(stmnt->area.Pos(), filename, firstRow))
+            continue;
+
+        auto UpdateFirstRow = [&](const AST* ast)
+        {
+            std::string astFilename;
+            unsigned int astRow = 0;
+            if (ast && GetSourceLocation(ast->area.Pos(), astFilename, astRow) && astFilename == filename)
+                firstRow = std::min(firstRow, astRow);
+        };
+
+        for (const auto& attrib : stmnt->attribs)
+            UpdateFirstRow(attrib.get());
+
+        if (auto funcDecl = stmnt->As<FunctionDecl>())
+            UpdateFirstRow(funcDecl->returnType.get());
+        else if (auto varDeclStmnt = stmnt->As<VarDeclStmnt>())
+            UpdateFirstRow(varDeclStmnt->typeSpecifier.get());
+        else if (auto structDeclStmnt = stmnt->As<StructDeclStmnt>())
+            UpdateFirstRow(structDeclStmnt->structDecl.get());
+
+        /* Type aliases are not marked by the reference analyzer, so they are always considered to be reachable */
+        bool reachable = (stmnt->flags(AST::isReachable) || stmnt->Type() == AST::Types::AliasDeclStmnt);
+
+        /* Declaration statements are also reachable through their referenced declarations */
+        auto AnyReachable = [&reachable](const AST* ast)
+        {
+            if (ast && ast->flags(AST::isReachable))
+                reachable = true;
+        };
+
+        if (auto varDeclStmnt = stmnt->As<VarDeclStmnt>())
+        {
+            for (const auto& varDecl : varDeclStmnt->varDecls)
+                AnyReachable(varDecl.get());
+        }
+        else if (auto structDeclStmnt = stmnt->As<StructDeclStmnt>())
+            AnyReachable(structDeclStmnt->structDecl.get());
+        else if (auto bufferDeclStmnt = stmnt->As<BufferDeclStmnt>())
+        {
+            for (const auto& bufferDecl : bufferDeclStmnt->bufferDecls)
+                AnyReachable(bufferDecl.get());
+        }
+        else if (auto samplerDeclStmnt = stmnt->As<SamplerDeclStmnt>())
+        {
+            for (const auto& samplerDecl : samplerDeclStmnt->samplerDecls)
+                AnyReachable(samplerDecl.get());
+        }
+
+        globalStmntRows[filename].push_back({ firstRow, reachable });
+    }
+
+    for (auto& rows : globalStmntRows)
+    {
+        std::stable_sort(
+            rows.second.begin(), rows.second.end(),
+            [](const GlobalStmntRows& lhs, const GlobalStmntRows& rhs)
+            {
+                return (lhs.firstRow < rhs.firstRow);
+            }
+        );
+    }
+
+    /* All macros of active conditions are relevant (except standard macros) */
+    std::set<std::string> relevantIdents;
+
+    for (const auto& ident : conditionMacros_)
+    {
+        auto it = macros_.find(ident);
+        if (it == macros_.end() || !it->second->stdMacro)
+            relevantIdents.insert(ident);
+    }
+
+    /* Macro expansions are only relevant if they are covered by a reachable global statement */
+    for (const auto& expansion : macroExpansions_)
+    {
+        auto it = globalStmntRows.find(expansion.filename);
+        if (it == globalStmntRows.end())
+            continue;
+
+        const auto& rows = it->second;
+
+        auto rowsIt = std::upper_bound(
+            rows.begin(), rows.end(), expansion.row,
+            [](unsigned int row, const GlobalStmntRows& stmntRows)
+            {
+                return (row < stmntRows.firstRow);
+            }
+        );
+
+        if (rowsIt != rows.begin() && (rowsIt - 1)->reachable)
+            relevantIdents.insert(expansion.ident);
+    }
+
+    return std::vector<std::string>(relevantIdents.begin(), relevantIdents.end());
+}
+
 
 /*
  * ======= Protected: =======
@@ -122,6 +299,121 @@ void PreProcessor::DefineMacro(const Macro& macro)
     }
 }
 
+// Returns the token string of the specified macro value (without new-lines and comments, like the value of a '#define'-directive).
+static TokenPtrString TokenizeMacroValue(const std::string& value)
+{
+    /* Cache token strings per thread, since the same macro values are usually used for many compilations (e.g. shader permutations) */
+    thread_local std::map<std::string, TokenPtrString> tokenStringCache;
+
+    auto it = tokenStringCache.find(value);
+    if (it != tokenStringCache.end())
+        return it->second;
+
+    if (tokenStringCache.size() >= 4096)
+        tokenStringCache.clear();
+
+    TokenPtrString tokenString;
+
+    PreProcessorScanner scanner;
+    if (scanner.ScanSource(std::make_shared<SourceCode>(std::make_shared<std::stringstream>(value))))
+    {
+        for (auto tkn = scanner.Next(); tkn->Type() != Token::Types::EndOfStream; tkn = scanner.Next())
+        {
+            if (tkn->Type() != Token::Types::NewLine && tkn->Type() != Token::Types::Comment)
+                tokenString.PushBack(tkn);
+        }
+    }
+
+    tokenStringCache[value] = tokenString;
+
+    return tokenString;
+}
+
+// Returns the specified string without leading and trailing white spaces.
+static std::string TrimWhiteSpaces(const std::string& s)
+{
+    const auto first = s.find_first_not_of(" \t");
+    if (first == std::string::npos)
+        return "";
+    const auto last = s.find_last_not_of(" \t");
+    return s.substr(first, last - first + 1);
+}
+
+void PreProcessor::DefinePredefinedMacro(const PredefinedMacro& predefinedMacro)
+{
+    Macro macro;
+
+    /* Split optional parameter list from identifier (e.g. "MUL(a,b)") */
+    auto ident = TrimWhiteSpaces(predefinedMacro.ident);
+
+    const auto paramListPos = ident.find('(');
+    if (paramListPos != std::string::npos)
+    {
+        const auto paramListEnd = ident.find(')', paramListPos);
+        if (paramListEnd == std::string::npos)
+            Error(R_InvalidMacroIdent(predefinedMacro.ident), SourceArea::ignore);
+
+        auto paramList = ident.substr(paramListPos + 1, paramListEnd - paramListPos - 1);
+
+        for (std::size_t start = 0; start <= paramList.size();)
+        {
+            auto end = paramList.find(',', start);
+            if (end == std::string::npos)
+                end = paramList.size();
+
+            auto param = TrimWhiteSpaces(paramList.substr(start, end - start));
+            if (param == "...")
+                macro.varArgs = true;
+            else if (!param.empty())
+                macro.parameters.push_back(param);
+
+            start = end + 1;
+        }
+
+        macro.emptyParamList = (macro.parameters.empty() && !macro.varArgs);
+
+        ident = TrimWhiteSpaces(ident.substr(0, paramListPos));
+    }
+
+    if (ident.empty() || ident.find_first_of(" \t") != std::string::npos)
+        Error(R_InvalidMacroIdent(predefinedMacro.ident), SourceArea::ignore);
+
+    macro.identTkn = std::make_shared<Token>(SourcePosition::ignore, Token::Types::Ident, ident);
+
+    /* Expand previously defined macros in the value, like in the value of a '#define'-directive */
+    const auto valueTokenString = TokenizeMacroValue(predefinedMacro.value);
+
+    for (const auto& tkn : valueTokenString.GetTokens())
+    {
+        if (tkn->Type() == Tokens::Ident)
+        {
+            auto it = macros_.find(tkn->Spell());
+            if ( it != macros_.end() && !it->second->HasParameterList() &&
+                 std::find(macro.parameters.begin(), macro.parameters.end(), tkn->Spell()) == macro.parameters.end() )
+            {
+                macro.tokenString.PushBack(it->second->tokenString);
+                macro.referencedMacros.push_back(tkn->Spell());
+                continue;
+            }
+        }
+        macro.tokenString.PushBack(tkn);
+    }
+
+    /* Ignore identical redefinitions (e.g. when the same macro has already been defined for a precompiled prelude) */
+    auto previousMacroIt = macros_.find(ident);
+    if (previousMacroIt != macros_.end())
+    {
+        const auto& previousMacro = *previousMacroIt->second;
+        if ( previousMacro.parameters == macro.parameters && previousMacro.varArgs == macro.varArgs &&
+             previousMacro.tokenString == macro.tokenString )
+        {
+            return;
+        }
+    }
+
+    DefineMacro(macro);
+}
+
 void PreProcessor::DefineStandardMacro(const std::string& ident, int intValue)
 {
     auto identTkn = std::make_shared<Token>(SourcePosition::ignore, Token::Types::Ident, ident);
@@ -159,24 +451,28 @@ bool PreProcessor::OnDefineMacro(const Macro& macro)
 
 bool PreProcessor::OnRedefineMacro(const Macro& macro, const Macro& previousMacro)
 {
-    /* Compare parameters and body */
-    auto mismatchParam  = (previousMacro.parameters != macro.parameters || previousMacro.varArgs != macro.varArgs);
-    auto mismatchBody   = (previousMacro.tokenString != macro.tokenString);
+    /* Don't compare the macros if the warning is not reported anyway (the hint would otherwise remain for the next report) */
+    if (WarnEnabled())
+    {
+        /* Compare parameters and body */
+        auto mismatchParam  = (previousMacro.parameters != macro.parameters || previousMacro.varArgs != macro.varArgs);
+        auto mismatchBody   = (previousMacro.tokenString != macro.tokenString);
 
-    /* Construct warning message */
-    std::string contextDesc;
+        /* Construct warning message */
+        std::string contextDesc;
 
-    if (mismatchParam && mismatchBody)
-        contextDesc = R_WithMismatchInParamListAndBody;
-    else if (mismatchParam)
-        contextDesc = R_WithMismatchInParamList;
-    else if (mismatchBody)
-        contextDesc = R_WithMismatchInBody;
+        if (mismatchParam && mismatchBody)
+            contextDesc = R_WithMismatchInParamListAndBody;
+        else if (mismatchParam)
+            contextDesc = R_WithMismatchInParamList;
+        else if (mismatchBody)
+            contextDesc = R_WithMismatchInBody;
 
-    if (auto previousMacroPos = previousMacro.identTkn->Pos())
-        ReportHandler::HintForNextReport(R_PrevDefinitionAt(previousMacroPos.ToString()));
+        if (auto previousMacroPos = previousMacro.identTkn->Pos())
+            ReportHandler::HintForNextReport(R_PrevDefinitionAt(previousMacroPos.ToString()));
 
-    Warning(R_MacroRedef(macro.identTkn->Spell(), contextDesc), macro.identTkn.get());
+        Warning(R_MacroRedef(macro.identTkn->Spell(), contextDesc), macro.identTkn.get());
+    }
 
     /* Always allow to redefine macros per default */
     return true;
@@ -202,6 +498,7 @@ void PreProcessor::PushScannerSource(const SourceCodePtr& source, const std::str
 {
     Parser::PushScannerSource(source, filename);
     GetScanner().Source()->NextSourceOrigin(filename, 0);
+    sources_.push_back(source);
     WritePosToLineDirective();
 }
 
@@ -355,12 +652,71 @@ TokenPtrString PreProcessor::ExpandMacro(const Macro& macro, const std::vector<T
     return expandedString;
 }
 
+void PreProcessor::RecordMacroUsage(const std::string& ident, const Token& identTkn)
+{
+    if (macroReferences_)
+    {
+        /* Macros in a definition value are expanded immediately, so only record them for the usage of the new macro */
+        if (macros_.find(ident) != macros_.end())
+            macroReferences_->push_back(ident);
+        return;
+    }
+
+    /* Record source location with the same line offset as the statements of the parser (see '#line'-directive) */
+    std::string filename;
+    unsigned int row = 0;
+    GetSourceLocation(identTkn.Pos(), filename, row);
+
+    /* Record macro and all macros that are referenced in its value (each macro only once to avoid endless recursion) */
+    std::set<std::string>       recordedIdents;
+    std::vector<std::string>    pendingIdents { ident };
+
+    while (!pendingIdents.empty())
+    {
+        auto currentIdent = pendingIdents.back();
+        pendingIdents.pop_back();
+
+        if (!recordedIdents.insert(currentIdent).second)
+            continue;
+
+        auto it = macros_.find(currentIdent);
+
+        if (parsingCondition_)
+        {
+            /* Record macro even if it is undefined, since defining it would change the condition */
+            conditionMacros_.insert(currentIdent);
+        }
+        else if (it != macros_.end() && !it->second->stdMacro)
+            macroExpansions_.push_back({ currentIdent, filename, row });
+
+        if (it != macros_.end())
+        {
+            for (const auto& tkn : it->second->tokenString.GetTokens())
+            {
+                if (tkn->Type() == Tokens::Ident && tkn->Spell() != "defined")
+                    pendingIdents.push_back(tkn->Spell());
+            }
+
+            for (const auto& refIdent : it->second->referencedMacros)
+                pendingIdents.push_back(refIdent);
+        }
+    }
+}
+
 void PreProcessor::WritePosToLineDirective()
 {
     if (writeLineMarks_)
     {
+        /* Write row with the line offset of the current source origin to keep previous '#line'-directives intact */
         auto pos = GetScanner().ActiveToken()->Pos();
-        Out() << "#line " << pos.Row() << " \"" << GetCurrentFilename() << '\"' << std::endl;
+
+        std::string filename;
+        unsigned int row = pos.Row();
+
+        if (!GetSourceLocation(pos, filename, row) || filename.empty())
+            filename = GetCurrentFilename();
+
+        Out() << "#line " << row << " \"" << filename << '\"' << std::endl;
     }
 }
 
@@ -449,6 +805,8 @@ TokenPtrString PreProcessor::ParseIdentAsTokenString()
     }
     else
     {
+        RecordMacroUsage(ident, *identTkn);
+
         /* Search for defined macro */
         auto it = macros_.find(ident);
         if (it != macros_.end())
@@ -653,7 +1011,11 @@ void PreProcessor::ParseDirectiveDefine()
     IgnoreWhiteSpaces();
     if (!Is(Tokens::NewLine))
     {
-        macro.tokenString = ParseDirectiveTokenString(false, true);
+        macroReferences_ = &(macro.referencedMacros);
+        {
+            macro.tokenString = ParseDirectiveTokenString(false, true);
+        }
+        macroReferences_ = nullptr;
 
         /* Append new-line characters from value (this is used to reproduce the correct line numbers) */
         for (const auto& tkn : macro.tokenString.GetTokens())
@@ -711,6 +1073,7 @@ void PreProcessor::ParseDirectiveInclude()
 
         try
         {
+            includeHandler_.FetchIncludedPath();
             includeStream = includeHandler_.Include(filename, useSearchPaths);
         }
         catch (const std::exception& e)
@@ -718,6 +1081,15 @@ void PreProcessor::ParseDirectiveInclude()
             Error(e.what());
         }
 
+        /* Get path of included file (the filename is used as it is, if the include handler does not report the path it has opened) */
+        auto path = includeHandler_.FetchIncludedPath();
+        if (path.empty())
+            path = filename;
+
+        /* Store path of included file */
+        if (std::find(includedFiles_.begin(), includedFiles_.end(), path) == includedFiles_.end())
+            includedFiles_.push_back(path);
+
         /* Push scanner soruce for include file */
         auto sourceCode = std::make_shared<SourceCode>(std::move(includeStream));
         PushScannerSource(sourceCode, filename);
@@ -745,7 +1117,12 @@ void PreProcessor::ParseDirectiveIfdef(bool skipEvaluation)
     {
         /* Parse identifier */
         IgnoreWhiteSpaces();
-        auto ident = Accept(Tokens::Ident)->Spell();
+        auto identTkn = Accept(Tokens::Ident);
+        auto ident = identTkn->Spell();
+
+        parsingCondition_ = true;
+        RecordMacroUsage(ident, *identTkn);
+        parsingCondition_ = false;
 
         /* Push new if-block activation (with 'defined' condExpr) */
         PushIfBlock(tkn, IsDefined(ident));
@@ -759,7 +1136,15 @@ void PreProcessor::ParseDirectiveIfndef(bool skipEvaluation)
 
     /* Parse identifier */
     IgnoreWhiteSpaces();
-    auto ident = Accept(Tokens::Ident)->Spell();
+    auto identTkn = Accept(Tokens::Ident);
+    auto ident = identTkn->Spell();
+
+    if (!skipEvaluation)
+    {
+        parsingCondition_ = true;
+        RecordMacroUsage(ident, *identTkn);
+        parsingCondition_ = false;
+    }
     
     /* Push new if-block activation (with 'not defined' condExpr) */
     PushIfBlock(tkn, !IsDefined(ident));
@@ -799,7 +1184,12 @@ void PreProcessor::ParseDirectiveIfOrElifCondition(bool isElseBranch, bool skipE
         */
         TokenPtrString tokenString;
         tokenString.PushBack(Make<Token>(Tokens::LBracket, "("));
-        tokenString.PushBack(ParseDirectiveTokenString(true));
+        {
+            /* Record all identifiers of the condition as condition macros */
+            parsingCondition_ = true;
+            tokenString.PushBack(ParseDirectiveTokenString(true));
+            parsingCondition_ = false;
+        }
         tokenString.PushBack(Make<Token>(Tokens::RBracket, ")"));
 
         /* Evalutate condExpr */
@@ -952,13 +1342,21 @@ void PreProcessor::ParseDirectiveLine()
     /* Parse optional filename */
     IgnoreWhiteSpaces();
 
+    std::string filename;
+
     if (Is(Tokens::StringLiteral))
     {
-        auto filename = AcceptIt()->SpellContent();
+        filename = AcceptIt()->SpellContent();
         Out() << " \"" << filename << '\"';
     }
+    else
+        filename = GetScanner().Source()->Filename();
 
     Out() << std::endl;
+
+    /* Set new line number and filename (like the parser does) to record macro usages in the same source location */
+    auto currentLine = static_cast<int>(GetScanner().PreviousToken()->Pos().Row());
+    GetScanner().NextSourceOrigin(filename, (std::stoi(lineNumber) - currentLine - 1));
 }
 
 // '#' 'error' TOKEN-STRING
@@ -1148,6 +1546,9 @@ std::string PreProcessor::ParseDefinedMacro()
     else
         macroIdent = Accept(Tokens::Ident)->Spell();
 
+    if (parsingCondition_)
+        conditionMacros_.insert(macroIdent);
+
     /* Determine value of integer literal ('1' if macro is defined, '0' otherwise */
     return (IsDefined(macroIdent) ? "1" : "0");
 }
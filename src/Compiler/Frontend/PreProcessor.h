@@ -39,19 +39,66 @@ class PreProcessor : public Parser
 {
     
     public:
-        
+
+        // Expansion of a macro in the code (i.e. outside of any directive) with the source position of the macro identifier.
+        struct MacroExpansion
+        {
+            std::string     ident;
+            std::string     filename;
+            unsigned int    row         = 0;
+        };
+
+        // State of the pre-processor together with its output after a source code has been processed (see PrecompilePrelude).
+        struct Snapshot;
+
         PreProcessor(IncludeHandler& includeHandler, Log* log = nullptr);
 
+        /*
+        Processes the input source code after all pre-defined macros have been registered (see ShaderInput::predefinedMacros).
+        If a snapshot is specified, the pre-processor continues with its state, and the output starts with the output of the snapshot.
+        If an output stream is specified, the output is written into that stream instead of a new string stream (see StreamPipe).
+        */
         std::unique_ptr<std::iostream> Process(
             const SourceCodePtr& input,
             const std::string& filename = "",
             bool writeLineMarks = true,
-            bool enableWarnings = false
+            bool enableWarnings = false,
+            const std::vector<PredefinedMacro>& predefinedMacros = {},
+            const Snapshot* snapshot = nullptr,
+            std::unique_ptr<std::iostream> output = nullptr
         );
 
+        // Returns a snapshot of the current state with the specified output (i.e. the output of the previous call to 'Process').
+        Snapshot MakeSnapshot(const std::string& output) const;
+
         // Returns a list of all defined macro identifiers after pre-processing.
         std::vector<std::string> ListDefinedMacroIdents() const;
 
+        // Returns the resolved paths of all included files in the order of their first inclusion.
+        inline const std::vector<std::string>& GetIncludedFiles() const
+        {
+            return includedFiles_;
+        }
+
+        // Returns the identifiers of all macros that are tested in active '#if'-conditions (including undefined macros).
+        inline const std::set<std::string>& GetConditionMacros() const
+        {
+            return conditionMacros_;
+        }
+
+        // Returns all macro expansions in the code (excluding standard macros).
+        inline const std::vector<MacroExpansion>& GetMacroExpansions() const
+        {
+            return macroExpansions_;
+        }
+
+        /*
+        Returns the sorted identifiers of all macros that influence the output code of the specified program,
+        i.e. macros that are tested in active '#if'-conditions, or expanded in global statements that are reachable from the entry point.
+        This must be called after all reachable AST nodes have been marked (see ReferenceAnalyzer).
+        */
+        std::vector<std::string> ListRelevantMacroIdents(const Program& program) const;
+
     protected:
 
         // Macro object structure.
@@ -78,6 +125,7 @@ class PreProcessor : public Parser
             TokenPtr                    identTkn;                   // Macro identifier token
             TokenPtrString              tokenString;                // Macro definition value as token string
             std::vector<std::string>    parameters;                 // Parameter identifiers
+            std::vector<std::string>    referencedMacros;           // Identifiers of macros that have been expanded in the definition value
             bool                        varArgs         = false;    // Specifies whether the macro supports variadic arguments
             bool                        stdMacro        = false;    // Specifies whether the macro is a standard macro (i.e. part of the language) or not
             bool                        emptyParamList  = false;    // Macro has an empty parameter list
@@ -89,6 +137,12 @@ class PreProcessor : public Parser
         // Defines a macro with the specified identifier, value token string, and parameters.
         void DefineMacro(const Macro& macro);
 
+        /*
+        Defines a pre-defined macro (i.e. not part of the source code) with the specified identifier and value.
+        This is equivalent to a '#define'-directive, but the value is tokenized only once for all compilations on the same thread.
+        */
+        void DefinePredefinedMacro(const PredefinedMacro& predefinedMacro);
+
         // Defines a standard macro (i.e. not part of the source code) with value set to integer literal '1'.
         void DefineStandardMacro(const std::string& ident, int intValue = 1);
 
@@ -108,7 +162,7 @@ class PreProcessor : public Parser
         virtual bool OnUndefineMacro(const Macro& macro);
 
         // Returns the output stream as reference.
-        inline std::stringstream& Out()
+        inline std::iostream& Out()
         {
             return *output_;
         }
@@ -151,6 +205,9 @@ class PreProcessor : public Parser
         */
         TokenPtrString ExpandMacro(const Macro& macro, const std::vector<TokenPtrString>& arguments);
 
+        // Records the specified macro identifier and all macros that are referenced in its value as condition macros or as macro expansion.
+        void RecordMacroUsage(const std::string& ident, const Token& identTkn);
+
         // Writes a '#line'-directive to the output with the current source position and filename.
         void WritePosToLineDirective();
 
@@ -192,11 +249,19 @@ class PreProcessor : public Parser
 
         IncludeHandler&                     includeHandler_;
 
-        std::unique_ptr<std::stringstream>  output_;
+        std::unique_ptr<std::iostream>      output_;
 
         std::map<std::string, MacroPtr>     macros_;
         std::set<std::string>               onceIncluded_;
 
+        std::vector<std::string>            includedFiles_;
+
+        std::set<std::string>               conditionMacros_;
+        std::vector<MacroExpansion>         macroExpansions_;
+
+        // All pushed source codes, which own the source origins of the macro tokens (see SourceCode::MakeSourceOrigin).
+        std::vector<SourceCodePtr>          sources_;
+
         /*
         Stack to store the info which if-block in the hierarchy is active.
         Once an if-block is inactive, all subsequent if-blocks are inactive, too.
@@ -204,7 +269,28 @@ class PreProcessor : public Parser
         std::stack<IfBlock>                 ifBlockStack_;
 
         bool                                writeLineMarks_         = true;
+        bool                                parsingCondition_       = false;
+        std::vector<std::string>*           macroReferences_        = nullptr;  // Referenced macros of the macro that is currently being defined.
+
+};
 
+// State of the pre-processor that is shared between all compilations with the same prelude (macros are never modified after their definition).
+struct PreProcessor::Snapshot
+{
+    std::map<std::string, MacroPtr>     macros;
+    std::set<std::string>               onceIncluded;
+    std::vector<std::string>            includedFiles;
+    std::set<std::string>               conditionMacros;
+    std::vector<MacroExpansion>         macroExpansions;
+    std::vector<SourceCodePtr>          sources;
+    std::string                         output;
+};
+
+// Precompiled prelude (see PrecompilePrelude).
+struct Prelude
+{
+    InputShaderVersion      shaderVersion   = InputShaderVersion::HLSL5;
+    PreProcessor::Snapshot  snapshot;
 };
 
 
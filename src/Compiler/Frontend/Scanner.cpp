@@ -61,6 +61,19 @@ TokenPtr Scanner::PreviousToken() const
     return prevToken_;
 }
 
+void Scanner::NextSourceOrigin(const std::string& filename, int lineOffset)
+{
+    source_->NextSourceOrigin(filename, lineOffset);
+
+    /* The active token has already been scanned with the previous source origin */
+    auto origin = source_->Pos().GetOrigin();
+
+    nextStartPos_.SetOrigin(origin);
+
+    if (activeToken_)
+        activeToken_->SetOrigin(origin);
+}
+
 
 /*
  * ======= Protected: =======
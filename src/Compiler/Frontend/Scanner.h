@@ -49,6 +49,9 @@ class Scanner
         // Returns the token previously returned by the "Next" function.
         TokenPtr ActiveToken() const;
 
+        // Sets the new source origin for the current source position and the active token (see SourceCode::NextSourceOrigin).
+        void NextSourceOrigin(const std::string& filename, int lineOffset);
+
         // Returns the token previously returned by the "Next" function.
         TokenPtr PreviousToken() const;
 
@@ -18,21 +18,35 @@ IncludeHandler::~IncludeHandler()
 {
 }
 
-static std::unique_ptr<std::istream> ReadFile(const std::string& filename)
+static bool FileExists(const std::string& filename)
 {
-    auto stream = std::unique_ptr<std::istream>(new std::ifstream(filename));
-    return (stream->good() ? std::move(stream) : nullptr);
+    std::ifstream file(filename);
+    return file.good();
 }
 
 std::unique_ptr<std::istream> IncludeHandler::Include(const std::string& filename, bool useSearchPathsFirst)
 {
-    if (!useSearchPathsFirst)
+    /* Read file from resolved path */
+    auto resolvedPath = ResolvePath(filename, useSearchPathsFirst);
+
+    if (!resolvedPath.empty())
     {
-        /* Read file from relative path */
-        auto file = ReadFile(filename);
-        if (file)
-            return file;
+        auto stream = std::unique_ptr<std::istream>(new std::ifstream(resolvedPath));
+        if (stream->good())
+        {
+            ReportIncludedPath(resolvedPath);
+            return stream;
+        }
     }
+
+    RuntimeErr("failed to include file: \"" + filename + "\"");
+}
+
+std::string IncludeHandler::ResolvePath(const std::string& filename, bool useSearchPathsFirst)
+{
+    /* Try relative path */
+    if (!useSearchPathsFirst && FileExists(filename))
+        return filename;
     
     /* Search file in search paths */
     for (const auto& path : searchPaths)
@@ -45,22 +59,33 @@ std::unique_ptr<std::istream> IncludeHandler::Include(const std::string& filenam
                 s += '/';
             s += filename;
 
-            /* Read file from current path */
-            auto file = ReadFile(s);
-            if (file)
-                return file;
+            if (FileExists(s))
+                return s;
         }
     }
 
-    if (useSearchPathsFirst)
-    {
-        /* Read file from relative path */
-        auto file = ReadFile(filename);
-        if (file)
-            return file;
-    }
+    /* Try relative path after search paths */
+    if (useSearchPathsFirst && FileExists(filename))
+        return filename;
 
-    RuntimeErr("failed to include file: \"" + filename + "\"");
+    return "";
+}
+
+std::string IncludeHandler::FetchIncludedPath()
+{
+    std::string path;
+    path.swap(includedPath_);
+    return path;
+}
+
+
+/*
+ * ======= Protected: =======
+ */
+
+void IncludeHandler::ReportIncludedPath(const std::string& path)
+{
+    includedPath_ = path;
 }
 
 
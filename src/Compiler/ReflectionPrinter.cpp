@@ -24,14 +24,19 @@ void ReflectionPrinter::PrintReflection(const Reflection::ReflectionData& reflec
     output_ << R_CodeReflection() << ':' << std::endl;
     indentHandler_.IncIndent();
     {
-        PrintReflectionObjects  ( reflectionData.macros,           "Macros"            );
-        PrintReflectionObjects  ( reflectionData.textures,         "Textures"          );
-        PrintReflectionObjects  ( reflectionData.storageBuffers,   "Storage Buffers"   );
-        PrintReflectionObjects  ( reflectionData.constantBuffers,  "Constant Buffers"  );
-        PrintReflectionObjects  ( reflectionData.inputAttributes,  "Input Attributes"  );
-        PrintReflectionObjects  ( reflectionData.outputAttributes, "Output Attributes" );
-        PrintReflectionObjects  ( reflectionData.samplerStates,    "Sampler States"    );
-        PrintReflectionAttribute( reflectionData.numThreads,       "Number of Threads" );
+        PrintReflectionObjects  ( reflectionData.macros,           "Macros"                   );
+        PrintReflectionObjects  ( reflectionData.includedFiles,    "Included Files"           );
+        PrintReflectionObjects  ( reflectionData.relevantMacros,   "Relevant Macros"          );
+        PrintReflectionObjects  ( reflectionData.textures,         "Textures"                 );
+        PrintReflectionObjects  ( reflectionData.storageBuffers,   "Storage Buffers"          );
+        PrintReflectionObjects  ( reflectionData.constantBuffers,  "Constant Buffers"         );
+        PrintReflectionObjects  ( reflectionData.bufferLayouts,    "Buffer Layouts"           );
+        PrintReflectionObjects  ( reflectionData.inputAttributes,  "Input Attributes"         );
+        PrintReflectionObjects  ( reflectionData.outputAttributes, "Output Attributes"        );
+        PrintReflectionObjects  ( reflectionData.samplerStates,    "Sampler States"           );
+        PrintReflectionObjects  ( reflectionData.specConstants,    "Specialization Constants" );
+        PrintReflectionObjects  ( reflectionData.pushConstants,    "Push Constants"           );
+        PrintReflectionAttribute( reflectionData.numThreads,       "Number of Threads"        );
     }
     indentHandler_.DecIndent();
 }
@@ -125,6 +130,59 @@ void ReflectionPrinter::PrintReflectionObjects(const std::map<std::string, Refle
         IndentOut() << "< none >" << std::endl;
 }
 
+void ReflectionPrinter::PrintReflectionObjects(const std::vector<Reflection::BufferLayout>& bufferLayouts, const std::string& title)
+{
+    IndentOut() << title << ':' << std::endl;
+    ScopedIndent indent(indentHandler_);
+
+    if (!bufferLayouts.empty())
+    {
+        for (const auto& bufferLayout : bufferLayouts)
+            PrintBufferLayout(bufferLayout);
+    }
+    else
+        IndentOut() << "< none >" << std::endl;
+}
+
+void ReflectionPrinter::PrintReflectionObjects(const Reflection::BufferLayout& bufferLayout, const std::string& title)
+{
+    IndentOut() << title << ':' << std::endl;
+    ScopedIndent indent(indentHandler_);
+
+    if (!bufferLayout.ident.empty())
+        PrintBufferLayout(bufferLayout);
+    else
+        IndentOut() << "< none >" << std::endl;
+}
+
+void ReflectionPrinter::PrintBufferLayout(const Reflection::BufferLayout& bufferLayout)
+{
+    IndentOut() << bufferLayout.ident << " (" << bufferLayout.size << " bytes)" << std::endl;
+    ScopedIndent indent(indentHandler_);
+
+    /* Determine offset for right-aligned field offsets */
+    unsigned int maxOffset = 0;
+    for (const auto& field : bufferLayout.fields)
+        maxOffset = std::max(maxOffset, field.offset);
+
+    std::size_t maxOffsetLen = std::to_string(maxOffset).size();
+
+    /* Print buffer fields with type, size, and optional strides */
+    for (const auto& field : bufferLayout.fields)
+    {
+        IndentOut()
+            << std::string(maxOffsetLen - std::to_string(field.offset).size(), ' ') << field.offset << ": "
+            << field.type << ' ' << field.ident << " (" << field.size << " bytes";
+
+        if (field.arrayStride > 0)
+            output_ << ", array stride " << field.arrayStride;
+        if (field.matrixStride > 0)
+            output_ << ", matrix stride " << field.matrixStride;
+
+        output_ << ')' << std::endl;
+    }
+}
+
 void ReflectionPrinter::PrintReflectionAttribute(const Reflection::NumThreads& numThreads, const std::string& title)
 {
     IndentOut() << title << ':' << std::endl;
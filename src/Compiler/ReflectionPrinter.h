@@ -34,8 +34,12 @@ class ReflectionPrinter
         void PrintReflectionObjects(const std::vector<Reflection::BindingSlot>& objects, const std::string& title);
         void PrintReflectionObjects(const std::vector<std::string>& idents, const std::string& title);
         void PrintReflectionObjects(const std::map<std::string, Reflection::SamplerState>& samplerStates, const std::string& title);
+        void PrintReflectionObjects(const std::vector<Reflection::BufferLayout>& bufferLayouts, const std::string& title);
+        void PrintReflectionObjects(const Reflection::BufferLayout& bufferLayout, const std::string& title);
         void PrintReflectionAttribute(const Reflection::NumThreads& numThreads, const std::string& title);
 
+        void PrintBufferLayout(const Reflection::BufferLayout& bufferLayout);
+
         std::ostream&   output_;
         IndentHandler   indentHandler_;
 
@@ -15,7 +15,8 @@ namespace Xsc
 {
 
 
-static std::vector<std::string> g_hintQueue;
+// Hints are queued per thread, so that multiple shaders can be compiled in parallel.
+static thread_local std::vector<std::string> g_hintQueue;
 
 ReportHandler::ReportHandler(const std::string& reportTypeName, Log* log) :
     reportTypeName_ { reportTypeName },
@@ -48,12 +49,19 @@ void ReportHandler::SubmitReport(
             return;
     }
 
-    /* Initialize output message */
-    auto outputMsg = typeName;
-    
     if (type == Report::Types::Error)
         hasErrors_ = true;
 
+    /* Discard report before any string is constructed, if it is neither thrown nor submitted to a log */
+    if (!breakWithExpection && !log_)
+    {
+        g_hintQueue.clear();
+        return;
+    }
+
+    /* Initialize output message */
+    auto outputMsg = typeName;
+
     /* Add source position */
     if (area.Pos().IsValid())
     {
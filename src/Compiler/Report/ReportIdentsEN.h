@@ -210,6 +210,7 @@ DECL_REPORT( UnknownPPDirective,                "unknown preprocessor directive:
 DECL_REPORT( UnknownMatrixPackAlignment,        "unknown matrix pack alignment: \"{0}\" (must be \"row_major\" or \"column_major\")"                            );
 DECL_REPORT( UnknownPragma,                     "unknown pragma: \"{0}\""                                                                                       );
 DECL_REPORT( InvalidMacroIdentTokenArg,         "invalid argument for macro identifier token"                                                                   );
+DECL_REPORT( InvalidMacroIdent,                 "invalid identifier for pre-defined macro: \"{0}\""                                                             );
 DECL_REPORT( FailedToUndefMacro,                "failed to undefine macro \"{0}\""                                                                              );
 DECL_REPORT( MacroRedef,                        "redefinition of macro \"{0}\"[ {1}]"                                                                           );
 DECL_REPORT( WithMismatchInParamListAndBody,    "with mismatch in parameter list and body definition"                                                           );
@@ -333,6 +334,10 @@ DECL_REPORT( NotAllStorageClassesMappedToGLSL,  "not all storage classes can be
 DECL_REPORT( NotAllInterpModMappedToGLSL,       "not all interpolation modifiers can be mapped to GLSL keywords"                                                );
 DECL_REPORT( CantTranslateSamplerToGLSL,        "can not translate sampler state object to GLSL sampler"                                                        );
 DECL_REPORT( MissingArrayPrefixForIOSemantic,   "missing array prefix expression for input/output semantic[ '{0}']"                                             );
+DECL_REPORT( PushConstantExceedsLimit,          "push constant limit of {0} bytes exceeded by constant buffer '{1}'[ ({2} bytes)]"                              );
+DECL_REPORT( MultiplePushConstantBuffers,       "only one push constant block allowed per shader[; '{0}' is emitted as uniform buffer]"                         );
+DECL_REPORT( CantPackUniformBuffer,             "constant buffer '{0}' can not be packed into a uniform array[, because of member '{1}']"                       );
+DECL_REPORT( PackOffsetOverlapsPrevMember,      "packoffset of member '{0}' overlaps with or precedes the previous member[ '{1}'] (GLSL requires increasing offsets)" );
 
 /* ----- GLSLPreProcessor ----- */
 
@@ -453,6 +458,12 @@ DECL_REPORT( ExpectedPatchFuncParamToBe,        "expected patch constant functio
 DECL_REPORT( EntryPointForPatchFuncNotFound,    "entry point \"{0}\" for patch constant function not found"                                                     );
 DECL_REPORT( MaxVertexCountMustBeGreaterZero,   "maximal vertex count must be greater than zero"                                                                );
 DECL_REPORT( NumThreadsMustBeGreaterZero,       "number of threads must be greater than zero"                                                                   );
+DECL_REPORT( SpecConstantMustBeGlobalConst,     "specialization constants must be global constants or uniforms"                                                 );
+DECL_REPORT( SpecConstantMustBeSingleVar,       "specialization constant attribute can only be applied to a single variable declaration"                        );
+DECL_REPORT( SpecConstantMustBeScalar,          "specialization constants must have a scalar type[, but got '{0}']"                                             );
+DECL_REPORT( SpecConstantIdMustNotBeNegative,   "specialization constant ID must not be negative"                                                               );
+DECL_REPORT( DuplicateSpecConstantId,           "duplicate specialization constant ID {0}[ (previously used by '{1}')]"                                         );
+DECL_REPORT( PushConstantMustBeCBuffer,         "push constant attribute can only be applied to constant buffers"                                               );
 DECL_REPORT( SecondaryArrayDimMustBeExplicit,   "secondary array dimensions must be explicit"                                                                   );
 DECL_REPORT( StructsCantBeDefinedInParam,       "structures can not be defined in a parameter type[: '{0}']"                                                    );
 DECL_REPORT( StaticMembersCantBeDefinedInGlob,  "static members can only be defined in global scope[: '{0}']"                                                   );
@@ -473,6 +484,12 @@ DECL_REPORT( ParsingSourceFailed,               "parsing input code failed"
 DECL_REPORT( AnalyzingSourceFailed,             "analyzing input code failed"                                                                                   );
 DECL_REPORT( GeneratingOutputCodeFailed,        "generating output code failed"                                                                                 );
 DECL_REPORT( OnlyPreProcessingForNonHLSL,       "only pre-processing supported for shaders other than HLSL or Cg"                                               );
+DECL_REPORT( OnlyPreludeForHLSL,                "precompiled preludes are only supported for HLSL or Cg"                                                        );
+DECL_REPORT( PreludeShaderVersionMismatch,      "shader version of precompiled prelude does not match the input shader version"                                 );
+DECL_REPORT( InvalidSerializedASTFormat,        "invalid format of serialized AST"                                                                              );
+DECL_REPORT( SerializedASTVersionMismatch,      "format version {0} of serialized AST does not match the expected version {1}"                                  );
+DECL_REPORT( SerializedASTInputMismatch,        "serialized AST was analyzed with a different input shader version, shader target, or entry point"              );
+DECL_REPORT( CorruptedSerializedAST,            "serialized AST is corrupted"                                                                                   );
 
 
 #endif
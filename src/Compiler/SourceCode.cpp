@@ -107,12 +107,18 @@ bool SourceCode::FetchLineMarker(const SourceArea& area, std::string& line, std:
 
 void SourceCode::NextSourceOrigin(const std::string& filename, int lineOffset)
 {
-    auto origin = std::make_shared<SourceOrigin>();
+    pos_.SetOrigin(MakeSourceOrigin(filename, lineOffset));
+}
+
+const SourceOrigin* SourceCode::MakeSourceOrigin(const std::string& filename, int lineOffset)
+{
+    auto origin = SourceOriginPtr(new SourceOrigin());
     {
         origin->filename    = filename;
         origin->lineOffset  = lineOffset;
     }
-    pos_.SetOrigin(origin);
+    origins_.emplace_back(std::move(origin));
+    return origins_.back().get();
 }
 
 std::string SourceCode::Filename() const
@@ -41,6 +41,9 @@ class SourceCode
         // Sets the new source origin for the current source position (see "Pos()").
         void NextSourceOrigin(const std::string& filename, int lineOffset);
 
+        // Returns a new source origin, which is owned by this source code (i.e. it is valid as long as this source code is alive).
+        const SourceOrigin* MakeSourceOrigin(const std::string& filename, int lineOffset);
+
         // Ignores the current character.
         inline void Ignore()
         {
@@ -62,6 +65,12 @@ class SourceCode
         // Returns the filename of the current source position (see SourcePosition::GetOrigin).
         std::string Filename() const;
 
+        // Returns all lines that have already been read.
+        inline const std::vector<std::string>& Lines() const
+        {
+            return lines_;
+        }
+
     protected:
         
         SourceCode() = default;
@@ -73,6 +82,7 @@ class SourceCode
         std::string                     currentLine_;
         std::vector<std::string>        lines_;
         SourcePosition                  pos_;
+        std::vector<SourceOriginPtr>    origins_;
 
 };
 
@@ -0,0 +1,103 @@
+/*
+ * SparseValue.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_SPARSE_VALUE_H
+#define XSC_SPARSE_VALUE_H
+
+
+#include <memory>
+
+
+namespace Xsc
+{
+
+
+/*
+Container for rarely populated values (e.g. comments and attribute lists of AST nodes), which is only allocated if the value is non-empty.
+An empty sparse value only has the size of a pointer. The type 'T' must provide the 'empty', 'begin', and 'end' functions (e.g. std::string or std::vector).
+*/
+template <typename T>
+class SparseValue
+{
+
+    public:
+
+        SparseValue() = default;
+        SparseValue(SparseValue&&) = default;
+        SparseValue& operator = (SparseValue&&) = default;
+
+        inline SparseValue(const SparseValue& rhs)
+        {
+            *this = rhs.Get();
+        }
+
+        inline SparseValue& operator = (const SparseValue& rhs)
+        {
+            *this = rhs.Get();
+            return *this;
+        }
+
+        // Takes the specified value, which is only allocated if it is non-empty.
+        inline SparseValue& operator = (T&& value)
+        {
+            if (value.empty())
+                value_.reset();
+            else
+                value_ = std::unique_ptr<T>(new T(std::move(value)));
+            return *this;
+        }
+
+        inline SparseValue& operator = (const T& value)
+        {
+            return (*this = T(value));
+        }
+
+        // Returns the value, or a static empty value if none is allocated.
+        inline const T& Get() const
+        {
+            if (value_)
+                return *value_;
+
+            static const T emptyValue;
+            return emptyValue;
+        }
+
+        inline operator const T& () const
+        {
+            return Get();
+        }
+
+        inline bool empty() const
+        {
+            return (!value_ || value_->empty());
+        }
+
+        inline typename T::const_iterator begin() const
+        {
+            return Get().begin();
+        }
+
+        inline typename T::const_iterator end() const
+        {
+            return Get().end();
+        }
+
+    private:
+
+        std::unique_ptr<T> value_;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
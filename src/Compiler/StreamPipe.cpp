@@ -0,0 +1,166 @@
+/*
+ * StreamPipe.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "StreamPipe.h"
+#include "Helper.h"
+#include <algorithm>
+
+
+namespace Xsc
+{
+
+
+StreamPipe::StreamPipe(std::size_t chunkSize, std::size_t maxNumChunks) :
+    writerBuffer_ { *this, std::max(chunkSize, std::size_t(1)) },
+    readerBuffer_ { *this                                      },
+    maxNumChunks_ { std::max(maxNumChunks, std::size_t(1))     }
+{
+}
+
+std::unique_ptr<std::iostream> StreamPipe::MakeWriter()
+{
+    return MakeUnique<PipeStream>(shared_from_this(), &writerBuffer_);
+}
+
+std::shared_ptr<std::istream> StreamPipe::MakeReader()
+{
+    return std::make_shared<PipeStream>(shared_from_this(), &readerBuffer_);
+}
+
+void StreamPipe::CloseWriter()
+{
+    writerBuffer_.PassChunk();
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+    writerClosed_ = true;
+    notEmpty_.notify_one();
+}
+
+void StreamPipe::CloseReader()
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+    readerClosed_ = true;
+    chunks_.clear();
+    notFull_.notify_one();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool StreamPipe::PushChunk(std::string&& chunk)
+{
+    std::unique_lock<std::mutex> lock { mutex_ };
+
+    notFull_.wait(lock, [this]() { return (readerClosed_ || chunks_.size() < maxNumChunks_); });
+
+    if (readerClosed_ || writerClosed_)
+        return false;
+
+    chunks_.emplace_back(std::move(chunk));
+    notEmpty_.notify_one();
+
+    return true;
+}
+
+bool StreamPipe::PopChunk(std::string& chunk)
+{
+    std::unique_lock<std::mutex> lock { mutex_ };
+
+    notEmpty_.wait(lock, [this]() { return (writerClosed_ || !chunks_.empty()); });
+
+    if (chunks_.empty())
+        return false;
+
+    chunk = std::move(chunks_.front());
+    chunks_.pop_front();
+    notFull_.notify_one();
+
+    return true;
+}
+
+
+/*
+ * PipeStream class
+ */
+
+StreamPipe::PipeStream::PipeStream(const std::shared_ptr<StreamPipe>& pipe, std::streambuf* buffer) :
+    std::iostream   { buffer },
+    pipe_           { pipe   }
+{
+}
+
+
+/*
+ * WriterBuffer class
+ */
+
+StreamPipe::WriterBuffer::WriterBuffer(StreamPipe& pipe, std::size_t chunkSize) :
+    pipe_   { pipe                },
+    buffer_ ( chunkSize, '\0'     )
+{
+    setp(&buffer_[0], &buffer_[0] + buffer_.size());
+}
+
+void StreamPipe::WriterBuffer::PassChunk()
+{
+    if (pptr() > pbase())
+    {
+        pipe_.PushChunk(std::string(pbase(), pptr()));
+        setp(&buffer_[0], &buffer_[0] + buffer_.size());
+    }
+}
+
+StreamPipe::WriterBuffer::int_type StreamPipe::WriterBuffer::overflow(int_type c)
+{
+    /* Pass full chunk to the reader, and continue with an empty buffer */
+    PassChunk();
+
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+    {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+    }
+
+    return traits_type::not_eof(c);
+}
+
+
+/*
+ * ReaderBuffer class
+ */
+
+StreamPipe::ReaderBuffer::ReaderBuffer(StreamPipe& pipe) :
+    pipe_ { pipe }
+{
+}
+
+StreamPipe::ReaderBuffer::int_type StreamPipe::ReaderBuffer::underflow()
+{
+    if (gptr() < egptr())
+        return traits_type::to_int_type(*gptr());
+
+    /* Wait for next non-empty chunk from the writer */
+    do
+    {
+        if (!pipe_.PopChunk(chunk_))
+            return traits_type::eof();
+    }
+    while (chunk_.empty());
+
+    setg(&chunk_[0], &chunk_[0], &chunk_[0] + chunk_.size());
+
+    return traits_type::to_int_type(*gptr());
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,134 @@
+/*
+ * StreamPipe.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_STREAM_PIPE_H
+#define XSC_STREAM_PIPE_H
+
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace Xsc
+{
+
+
+/*
+Pipe to pass text from a writer thread to a reader thread (e.g. from the pre-processor to the parser).
+The text is passed in chunks through a bounded queue, i.e. the writer is blocked if the reader falls behind.
+Flushing the writer stream does not pass the current chunk, only full chunks are passed until the writer is closed.
+The writer and reader streams keep the pipe alive, so the pipe must be created as shared pointer.
+*/
+class StreamPipe : public std::enable_shared_from_this<StreamPipe>
+{
+
+    public:
+
+        StreamPipe(std::size_t chunkSize = 4096, std::size_t maxNumChunks = 64);
+
+        StreamPipe(const StreamPipe&) = delete;
+        StreamPipe& operator = (const StreamPipe&) = delete;
+
+        // Returns a new stream to write into the pipe. Only one writer stream must be used.
+        std::unique_ptr<std::iostream> MakeWriter();
+
+        // Returns a new stream to read from the pipe. Only one reader stream must be used.
+        std::shared_ptr<std::istream> MakeReader();
+
+        // Passes the remaining text of the writer and signals the end of the stream to the reader.
+        void CloseWriter();
+
+        // Signals the writer that no more text is read, i.e. all further text is discarded.
+        void CloseReader();
+
+    private:
+
+        // Stream that shares the ownership of the pipe.
+        class PipeStream : public std::iostream
+        {
+
+            public:
+
+                PipeStream(const std::shared_ptr<StreamPipe>& pipe, std::streambuf* buffer);
+
+            private:
+
+                std::shared_ptr<StreamPipe> pipe_;
+
+        };
+
+        class WriterBuffer : public std::streambuf
+        {
+
+            public:
+
+                WriterBuffer(StreamPipe& pipe, std::size_t chunkSize);
+
+                void PassChunk();
+
+            protected:
+
+                int_type overflow(int_type c) override;
+
+            private:
+
+                StreamPipe& pipe_;
+                std::string buffer_;
+
+        };
+
+        class ReaderBuffer : public std::streambuf
+        {
+
+            public:
+
+                ReaderBuffer(StreamPipe& pipe);
+
+            protected:
+
+                int_type underflow() override;
+
+            private:
+
+                StreamPipe& pipe_;
+                std::string chunk_;
+
+        };
+
+        // Pushes the chunk into the queue, blocks while the queue is full, and returns false if the reader has been closed.
+        bool PushChunk(std::string&& chunk);
+
+        // Pops the next chunk from the queue, blocks while the queue is empty, and returns false at the end of the stream.
+        bool PopChunk(std::string& chunk);
+
+        WriterBuffer                writerBuffer_;
+        ReaderBuffer                readerBuffer_;
+
+        std::size_t                 maxNumChunks_   = 0;
+        std::deque<std::string>     chunks_;
+        bool                        writerClosed_   = false;
+        bool                        readerClosed_   = false;
+
+        std::mutex                  mutex_;
+        std::condition_variable     notFull_;
+        std::condition_variable     notEmpty_;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -21,6 +21,12 @@ namespace Xsc
  * Global (and internal) functions
  */
 
+// Maximal length difference of identifiers that are considered to be similar.
+static const std::size_t g_similarIdentMaxLenDiff = 3;
+
+// Maximal number of identifiers that are compared with 'StringDistance' for a single query.
+static const std::size_t g_similarIdentMaxCandidates = 4096;
+
 static unsigned int StringDistancePrimary(const std::string& lhs, const std::string& rhs, unsigned int shiftOnUneq)
 {
     static const unsigned int diffUneqCaseEq    = 1;
@@ -62,7 +68,7 @@ static unsigned int StringDistancePrimary(const std::string& lhs, const std::str
 unsigned int StringDistance(const std::string& a, const std::string& b)
 {
     static const unsigned int maxDist = ~0;
-    static const unsigned int maxLenDiff = 3;
+    static const unsigned int maxLenDiff = static_cast<unsigned int>(g_similarIdentMaxLenDiff);
     static const unsigned int maxShift = 2;
 
     if (a == b)
@@ -102,10 +108,109 @@ void RuntimeErrIdentAlreadyDeclared(const std::string& ident)
 }
 
 
+/*
+ * SimilarIdentIndex class
+ */
+
+void SimilarIdentIndex::Clear()
+{
+    entriesByLength_.clear();
+    numEntries_ = 0;
+}
+
+void SimilarIdentIndex::Add(const std::string& ident)
+{
+    if (ident.size() >= entriesByLength_.size())
+        entriesByLength_.resize(ident.size() + 1);
+    entriesByLength_[ident.size()].push_back({ numEntries_++, &ident });
+}
+
+std::string SimilarIdentIndex::FetchSimilar(const std::string& ident) const
+{
+    const Entry* similar = nullptr;
+    unsigned int dist = ~0;
+    std::size_t numCandidates = 0;
+
+    auto CompareWithEntries = [&](std::size_t len)
+    {
+        if (len >= entriesByLength_.size())
+            return;
+
+        for (const auto& entry : entriesByLength_[len])
+        {
+            if (numCandidates >= g_similarIdentMaxCandidates)
+                return;
+
+            ++numCandidates;
+
+            auto d = StringDistance(ident, *entry.ident);
+            if (d < dist || (d == dist && similar != nullptr && entry.order < similar->order))
+            {
+                similar = (&entry);
+                dist = d;
+            }
+        }
+    };
+
+    /* Compare with identifiers of equal length first, then with increasing length difference */
+    CompareWithEntries(ident.size());
+
+    for (std::size_t lenDiff = 1; lenDiff <= g_similarIdentMaxLenDiff; ++lenDiff)
+    {
+        if (ident.size() >= lenDiff)
+            CompareWithEntries(ident.size() - lenDiff);
+        CompareWithEntries(ident.size() + lenDiff);
+    }
+
+    /* Check if the distance is not too large */
+    if (similar != nullptr && dist < ident.size())
+        return *(similar->ident);
+
+    /* No similarities found */
+    return "";
+}
+
+
 /*
  * ASTSymbolOverload class
  */
 
+// Converts the specified argument type denoters into a type list, and returns false if any of them is not a base type.
+static bool MakeTypeList(const std::vector<TypeDenoterPtr>& typeDens, IntrinsicUsage::ArgumentList& typeList)
+{
+    if (typeDens.size() > IntrinsicUsage::ArgumentList::maxNumArgs)
+        return false;
+
+    for (const auto& typeDen : typeDens)
+    {
+        if (auto baseTypeDen = typeDen->As<BaseTypeDenoter>())
+            typeList.Append(baseTypeDen->dataType);
+        else
+            return false;
+    }
+
+    return true;
+}
+
+// Converts the parameter types of the specified function into a type list, and returns false if any of them is not a base type.
+static bool MakeTypeList(const FunctionDecl& funcDecl, IntrinsicUsage::ArgumentList& typeList)
+{
+    if (funcDecl.parameters.size() > IntrinsicUsage::ArgumentList::maxNumArgs)
+        return false;
+
+    for (const auto& param : funcDecl.parameters)
+    {
+        if (param->varDecls.size() != 1)
+            return false;
+        if (auto baseTypeDen = param->varDecls.front()->GetTypeDenoter()->As<BaseTypeDenoter>())
+            typeList.Append(baseTypeDen->dataType);
+        else
+            return false;
+    }
+
+    return true;
+}
+
 ASTSymbolOverload::ASTSymbolOverload(const std::string& ident, AST* ast) :
     ident_{ ident }
 {
@@ -118,6 +223,9 @@ bool ASTSymbolOverload::AddSymbolRef(AST* ast)
     if (!ast)
         return false;
 
+    /* Previously resolved function calls might resolve to the new overload */
+    InvalidateOverloadIndex();
+
     /* Is this the first symbol reference? */
     if (!refs_.empty())
     {
@@ -247,6 +355,24 @@ FunctionDecl* ASTSymbolOverload::FetchFunctionDecl(const std::vector<TypeDenoter
     if (refs_.front()->Type() != AST::Types::FunctionDecl)
         RuntimeErr(R_IdentIsNotFunc(ident_));
 
+    /* Find function declaration in overload index or in the cache of resolved function calls */
+    TypeList argTypeList;
+    const bool isIndexable = MakeTypeList(argTypeDenoters, argTypeList);
+
+    if (isIndexable)
+    {
+        if (!overloadIndexValid_)
+            BuildOverloadIndex();
+
+        auto it = resolvedOverloads_.find(argTypeList);
+        if (it != resolvedOverloads_.end())
+            return it->second;
+
+        it = exactOverloads_.find(argTypeList);
+        if (it != exactOverloads_.end() && it->second != nullptr)
+            return it->second;
+    }
+
     /* Convert symbol references to function declaration pointers */
     std::vector<FunctionDecl*> funcDeclList;
     funcDeclList.reserve(refs_.size());
@@ -259,8 +385,54 @@ FunctionDecl* ASTSymbolOverload::FetchFunctionDecl(const std::vector<TypeDenoter
             RuntimeErr(R_AmbiguousSymbol(ident_));
     }
 
-    /* Fetch function declaration from list */
-    return FunctionDecl::FetchFunctionDeclFromList(funcDeclList, ident_, argTypeDenoters);
+    /* Fetch function declaration from list (with implicit type conversion) and store result for the next function call */
+    auto funcDecl = FunctionDecl::FetchFunctionDeclFromList(funcDeclList, ident_, argTypeDenoters);
+
+    if (isIndexable && funcDecl != nullptr)
+        resolvedOverloads_[argTypeList] = funcDecl;
+
+    return funcDecl;
+}
+
+void ASTSymbolOverload::BuildOverloadIndex() const
+{
+    exactOverloads_.clear();
+    resolvedOverloads_.clear();
+    overloadIndexValid_ = true;
+
+    std::vector<std::pair<TypeList, FunctionDecl*>> overloads;
+    overloads.reserve(refs_.size());
+
+    for (auto ref : refs_)
+    {
+        auto funcDecl = ref->As<FunctionDecl>();
+        if (!funcDecl)
+            return;
+
+        /* Overloads with default arguments can also match shorter argument lists, so the index is not used at all */
+        if (funcDecl->NumMinArgs() != funcDecl->NumMaxArgs())
+            return;
+
+        /* Only overloads with base type parameters are indexed */
+        TypeList paramTypeList;
+        if (MakeTypeList(*funcDecl, paramTypeList))
+            overloads.push_back({ paramTypeList, funcDecl });
+    }
+
+    for (const auto& overload : overloads)
+    {
+        /* Overloads with equal parameter types (e.g. with different storage classes) are ambiguous */
+        auto result = exactOverloads_.insert(overload);
+        if (!result.second)
+            result.first->second = nullptr;
+    }
+}
+
+void ASTSymbolOverload::InvalidateOverloadIndex()
+{
+    overloadIndexValid_ = false;
+    exactOverloads_.clear();
+    resolvedOverloads_.clear();
 }
 
 
@@ -11,6 +11,7 @@
 
 #include "AST.h"
 #include <map>
+#include <unordered_map>
 #include <string>
 #include <stack>
 #include <vector>
@@ -31,6 +32,37 @@ void RuntimeErrNoActiveScope();
 void RuntimeErrIdentAlreadyDeclared(const std::string& ident);
 
 
+/*
+Index of identifiers for suggestions of typos. The identifiers are grouped by their length,
+since 'StringDistance' only considers identifiers whose lengths differ by at most a few characters.
+*/
+class SimilarIdentIndex
+{
+
+    public:
+
+        // Removes all identifiers from this index.
+        void Clear();
+
+        // Adds the specified identifier to this index. The string must remain valid as long as it is part of this index.
+        void Add(const std::string& ident);
+
+        // Returns the identifier that is most similar to the specified identifier, or an empty string if there is no such identifier.
+        std::string FetchSimilar(const std::string& ident) const;
+
+    private:
+
+        struct Entry
+        {
+            std::size_t         order;  // Insertion order (the first identifier is preferred for equal distances).
+            const std::string*  ident;
+        };
+
+        std::vector<std::vector<Entry>> entriesByLength_;
+        std::size_t                     numEntries_         = 0;
+
+};
+
 template <typename T>
 struct GenericDefaultValue
 {
@@ -94,6 +126,7 @@ class SymbolTable
                         {
                             /* Remove symbol entry completely if it's reference list is empty */
                             symTable_.erase(it);
+                            similarIdentIndexValid_ = false;
                         }
                     }
                 }
@@ -131,7 +164,11 @@ class SymbolTable
             }
 
             /* Register new identifier */
-            symTable_[ident].push({ symbol, ScopeLevel() });
+            auto& symbolStack = symTable_[ident];
+            if (symbolStack.empty())
+                similarIdentIndexValid_ = false;
+
+            symbolStack.push({ symbol, ScopeLevel() });
             scopeStack_.top().push_back(ident);
 
             return true;
@@ -163,26 +200,17 @@ class SymbolTable
         // Returns an identifier that is similar to the specified identifier (for suggestions of typos)
         std::string FetchSimilar(const std::string& ident) const
         {
-            /* Find similar identifiers */
-            const std::string* similar = nullptr;
-            unsigned int dist = ~0;
-
-            for (const auto& symbol : symTable_)
+            /* Rebuild index if symbols have been added or removed since the last query */
+            if (!similarIdentIndexValid_)
             {
-                auto d = StringDistance(ident, symbol.first);
-                if (d < dist)
-                {
-                    similar = (&symbol.first);
-                    dist = d;
-                }
+                similarIdentIndex_.Clear();
+                for (const auto& symbol : symTable_)
+                    similarIdentIndex_.Add(symbol.first);
+                similarIdentIndexValid_ = true;
             }
 
-            /* Check if the distance is not too large */
-            if (similar != nullptr && dist < ident.size())
-                return *similar;
-
-            /* No similarities found */
-            return "";
+            /* Find similar identifiers */
+            return similarIdentIndex_.FetchSimilar(ident);
         }
 
         // Returns current scope level.
@@ -214,6 +242,10 @@ class SymbolTable
         */
         std::stack<std::vector<std::string>>        scopeStack_;
 
+        // Index of all identifiers in "symTable_" (built on demand, see 'FetchSimilar').
+        mutable SimilarIdentIndex                   similarIdentIndex_;
+        mutable bool                                similarIdentIndexValid_ = false;
+
 };
 
 
@@ -257,9 +289,24 @@ class ASTSymbolOverload
 
     private:
 
+        // Key for the overload index: list of base data types of arguments or parameters.
+        using TypeList = IntrinsicUsage::ArgumentList;
+
+        using OverloadMap = std::unordered_map<TypeList, FunctionDecl*, TypeList::Hash>;
+
+        // Builds the index of all overloads that only have base type parameters and no default arguments.
+        void BuildOverloadIndex() const;
+
+        // Clears the overload index and all resolved function calls.
+        void InvalidateOverloadIndex();
+
         std::string         ident_;
         std::vector<AST*>   refs_;
 
+        mutable bool        overloadIndexValid_ = false;
+        mutable OverloadMap exactOverloads_;            // Overloads by their exact parameter types (null for ambiguous signatures).
+        mutable OverloadMap resolvedOverloads_;         // Cache of previously resolved function calls with base type arguments only.
+
 };
 
 using ASTSymbolOverloadPtr = std::shared_ptr<ASTSymbolOverload>;
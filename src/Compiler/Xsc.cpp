@@ -17,6 +17,8 @@
 #include "ReflectionAnalyzer.h"
 #include "ReflectionPrinter.h"
 #include "ASTPrinter.h"
+#include "ASTSerializer.h"
+#include "StreamPipe.h"
 #include "ASTEnums.h"
 #include "ReportIdents.h"
 #include <fstream>
@@ -24,6 +26,8 @@
 #include <algorithm>
 #include <chrono>
 #include <array>
+#include <thread>
+#include <exception>
 
 
 namespace Xsc
@@ -37,6 +41,163 @@ namespace Xsc
 using Time      = std::chrono::system_clock;
 using TimePoint = std::chrono::time_point<std::chrono::system_clock>;
 
+// Log to buffer all reports of a worker thread, to submit them in a deterministic order afterwards.
+class ReportBuffer : public Log
+{
+
+    public:
+
+        void SumitReport(const Report& report) override
+        {
+            reports_.push_back(report);
+        }
+
+        // Submits all buffered reports to the specified log.
+        void Flush(Log& log)
+        {
+            for (const auto& report : reports_)
+                log.SumitReport(report);
+            reports_.clear();
+        }
+
+    private:
+
+        std::vector<Report> reports_;
+
+};
+
+/*
+Pre-processes the input code on a separate thread while the HLSL parser reads the output of the pre-processor on the calling thread.
+Returns false if pre-processing failed. In this case, all reports of the parser are discarded, since it has only read a partial input code.
+*/
+static bool PreProcessAndParseHLSLPipelined(
+    PreProcessor& preProcessor, const ShaderInput& inputDesc, const ShaderOutput& outputDesc,
+    Log* log, ProgramPtr& program, TimePoint& preProcessingEnd)
+{
+    auto                pipe                = std::make_shared<StreamPipe>();
+    bool                preProcessorResult  = false;
+    std::exception_ptr  preProcessorError;
+
+    std::thread preProcessorThread(
+        [&]()
+        {
+            try
+            {
+                auto processedInput = preProcessor.Process(
+                    std::make_shared<SourceCode>(inputDesc.sourceCode),
+                    inputDesc.filename,
+                    true,
+                    ((inputDesc.warnings & Warnings::PreProcessor) != 0),
+                    inputDesc.predefinedMacros,
+                    (inputDesc.prelude ? &(inputDesc.prelude->snapshot) : nullptr),
+                    pipe->MakeWriter()
+                );
+                preProcessorResult = (processedInput != nullptr);
+            }
+            catch (...)
+            {
+                preProcessorError = std::current_exception();
+            }
+
+            pipe->CloseWriter();
+            preProcessingEnd = Time::now();
+        }
+    );
+
+    /* Parse HLSL input code while it is pre-processed (parser reports are buffered, since the pre-processor submits reports concurrently) */
+    ReportBuffer parserReports;
+
+    try
+    {
+        HLSLParser parser(log != nullptr ? &parserReports : nullptr);
+        program = parser.ParseSource(
+            std::make_shared<SourceCode>(pipe->MakeReader()),
+            outputDesc.nameMangling,
+            inputDesc.shaderVersion,
+            outputDesc.options.rowMajorAlignment,
+            ((inputDesc.warnings & Warnings::Syntax) != 0)
+        );
+    }
+    catch (...)
+    {
+        pipe->CloseReader();
+        preProcessorThread.join();
+        throw;
+    }
+
+    /* Discard remaining output, if the parser stopped early */
+    pipe->CloseReader();
+    preProcessorThread.join();
+
+    if (preProcessorError)
+        std::rethrow_exception(preProcessorError);
+
+    if (!preProcessorResult)
+    {
+        program = nullptr;
+        return false;
+    }
+
+    if (log)
+        parserReports.Flush(*log);
+
+    return true;
+}
+
+// Optimizes the decorated AST, generates the output code, and reflects the program.
+static bool CompileShaderBackend(
+    Program& program, const ShaderInput& inputDesc, const ShaderOutput& outputDesc,
+    Log* log, Reflection::ReflectionData* reflectionData,
+    std::array<TimePoint, 6>& timePoints)
+{
+    auto SubmitError = [log](const std::string& msg)
+    {
+        if (log)
+            log->SumitReport(Report(Report::Types::Error, msg));
+        return false;
+    };
+
+    /* Optimize AST */
+    timePoints[3] = Time::now();
+
+    if (outputDesc.options.optimize)
+    {
+        Optimizer optimizer;
+        optimizer.Optimize(program);
+    }
+
+    /* ----- Code generation ----- */
+
+    timePoints[4] = Time::now();
+
+    bool generatorResult = false;
+
+    if (IsLanguageGLSL(outputDesc.shaderVersion) || IsLanguageESSL(outputDesc.shaderVersion) || IsLanguageVKSL(outputDesc.shaderVersion))
+    {
+        /* Generate GLSL output code */
+        GLSLGenerator generator(log);
+        generatorResult = generator.GenerateCode(program, inputDesc, outputDesc, log);
+    }
+
+    if (!generatorResult)
+        return SubmitError(R_GeneratingOutputCodeFailed);
+
+    /* ----- Code reflection ----- */
+
+    timePoints[5] = Time::now();
+
+    if (reflectionData)
+    {
+        ReflectionAnalyzer reflectAnalyzer(log);
+        reflectAnalyzer.Reflect(
+            program, inputDesc.shaderTarget, outputDesc.shaderVersion, *reflectionData,
+            ((inputDesc.warnings & Warnings::CodeReflection) != 0)
+        );
+    }
+
+    return true;
+}
+
 static bool CompileShaderPrimary(
     const ShaderInput& inputDesc, const ShaderOutput& outputDesc,
     Log* log, Reflection::ReflectionData* reflectionData,
@@ -50,7 +211,9 @@ static bool CompileShaderPrimary(
     };
 
     /* Validate arguments */
-    if (!inputDesc.sourceCode)
+    const bool useAnalyzedAST = (inputDesc.analyzedAST != nullptr && !outputDesc.options.preprocessOnly);
+
+    if (!inputDesc.sourceCode && !useAnalyzedAST)
         throw std::invalid_argument(R_InputStreamCantBeNull);
     
     if (!outputDesc.sourceCode)
@@ -84,6 +247,44 @@ static bool CompileShaderPrimary(
         }
     }
 
+    if (inputDesc.prelude && inputDesc.prelude->shaderVersion != inputDesc.shaderVersion)
+        return SubmitError(R_PreludeShaderVersionMismatch);
+
+    if (useAnalyzedAST)
+    {
+        /* ----- Deserialization ----- */
+
+        timePoints[0] = Time::now();
+
+        /* Establish intrinsic adept (also required for code generation) */
+        std::unique_ptr<IntrinsicAdept> intrinsicAdpet;
+
+        if (IsLanguageHLSL(inputDesc.shaderVersion))
+            intrinsicAdpet = MakeUnique<HLSLIntrinsicAdept>();
+
+        ProgramPtr program;
+
+        try
+        {
+            program = DeserializeAST(*inputDesc.analyzedAST, inputDesc);
+        }
+        catch (const std::exception& e)
+        {
+            return SubmitError(e.what());
+        }
+
+        timePoints[1] = timePoints[2] = Time::now();
+
+        /* Print AST */
+        if (outputDesc.options.showAST && log)
+        {
+            ASTPrinter printer;
+            printer.PrintAST(program.get(), *log);
+        }
+
+        return CompileShaderBackend(*program, inputDesc, outputDesc, log, reflectionData, timePoints);
+    }
+
     /* ----- Pre-processing ----- */
 
     timePoints[0] = Time::now();
@@ -101,17 +302,42 @@ static bool CompileShaderPrimary(
     else if (IsLanguageGLSL(inputDesc.shaderVersion))
         preProcessor = MakeUnique<GLSLPreProcessor>(*includeHandler, log);
 
-    auto processedInput = preProcessor->Process(
-        std::make_shared<SourceCode>(inputDesc.sourceCode),
-        inputDesc.filename,
-        true,
-        ((inputDesc.warnings & Warnings::PreProcessor) != 0)
-    );
+    /* Pipeline pre-processing and parsing if enabled (only for HLSL, since it's the only language with a parser) */
+    const bool pipelined = (outputDesc.options.pipelinedFrontend && IsLanguageHLSL(inputDesc.shaderVersion) && !outputDesc.options.preprocessOnly);
+
+    std::unique_ptr<IntrinsicAdept> intrinsicAdpet;
+    ProgramPtr program;
+
+    std::unique_ptr<std::iostream> processedInput;
+    bool preProcessorResult = false;
+
+    if (pipelined)
+    {
+        /* Establish intrinsic adept */
+        intrinsicAdpet = MakeUnique<HLSLIntrinsicAdept>();
+
+        preProcessorResult = PreProcessAndParseHLSLPipelined(*preProcessor, inputDesc, outputDesc, log, program, timePoints[1]);
+    }
+    else
+    {
+        processedInput = preProcessor->Process(
+            std::make_shared<SourceCode>(inputDesc.sourceCode),
+            inputDesc.filename,
+            true,
+            ((inputDesc.warnings & Warnings::PreProcessor) != 0),
+            inputDesc.predefinedMacros,
+            (inputDesc.prelude ? &(inputDesc.prelude->snapshot) : nullptr)
+        );
+        preProcessorResult = (processedInput != nullptr);
+    }
 
     if (reflectionData)
-        reflectionData->macros = preProcessor->ListDefinedMacroIdents();
+    {
+        reflectionData->macros          = preProcessor->ListDefinedMacroIdents();
+        reflectionData->includedFiles   = preProcessor->GetIncludedFiles();
+    }
 
-    if (!processedInput)
+    if (!preProcessorResult)
         return SubmitError(R_PreProcessingSourceFailed);
 
     if (outputDesc.options.preprocessOnly)
@@ -122,25 +348,25 @@ static bool CompileShaderPrimary(
 
     /* ----- Parsing ----- */
 
-    timePoints[1] = Time::now();
-
-    std::unique_ptr<IntrinsicAdept> intrinsicAdpet;
-    ProgramPtr program;
-
-    if (IsLanguageHLSL(inputDesc.shaderVersion))
+    if (!pipelined)
     {
-        /* Establish intrinsic adept */
-        intrinsicAdpet = MakeUnique<HLSLIntrinsicAdept>();
+        timePoints[1] = Time::now();
 
-        /* Parse HLSL input code */
-        HLSLParser parser(log);
-        program = parser.ParseSource(
-            std::make_shared<SourceCode>(std::move(processedInput)),
-            outputDesc.nameMangling,
-            inputDesc.shaderVersion,
-            outputDesc.options.rowMajorAlignment,
-            ((inputDesc.warnings & Warnings::Syntax) != 0)
-        );
+        if (IsLanguageHLSL(inputDesc.shaderVersion))
+        {
+            /* Establish intrinsic adept */
+            intrinsicAdpet = MakeUnique<HLSLIntrinsicAdept>();
+
+            /* Parse HLSL input code */
+            HLSLParser parser(log);
+            program = parser.ParseSource(
+                std::make_shared<SourceCode>(std::move(processedInput)),
+                outputDesc.nameMangling,
+                inputDesc.shaderVersion,
+                outputDesc.options.rowMajorAlignment,
+                ((inputDesc.warnings & Warnings::Syntax) != 0)
+            );
+        }
     }
 
     if (!program)
@@ -169,43 +395,16 @@ static bool CompileShaderPrimary(
     if (!analyzerResult)
         return SubmitError(R_AnalyzingSourceFailed);
 
-    /* Optimize AST */
-    timePoints[3] = Time::now();
+    /* Write decorated AST for later compilations */
+    if (outputDesc.analyzedAST)
+        SerializeAST(*program, inputDesc, *outputDesc.analyzedAST);
 
-    if (outputDesc.options.optimize)
-    {
-        Optimizer optimizer;
-        optimizer.Optimize(*program);
-    }
-
-    /* ----- Code generation ----- */
-
-    timePoints[4] = Time::now();
-
-    bool generatorResult = false;
-
-    if (IsLanguageGLSL(outputDesc.shaderVersion) || IsLanguageESSL(outputDesc.shaderVersion) || IsLanguageVKSL(outputDesc.shaderVersion))
-    {
-        /* Generate GLSL output code */
-        GLSLGenerator generator(log);
-        generatorResult = generator.GenerateCode(*program, inputDesc, outputDesc, log);
-    }
-
-    if (!generatorResult)
-        return SubmitError(R_GeneratingOutputCodeFailed);
-
-    /* ----- Code reflection ----- */
-
-    timePoints[5] = Time::now();
+    if (!CompileShaderBackend(*program, inputDesc, outputDesc, log, reflectionData, timePoints))
+        return false;
 
+    /* Reflect macros that influence the output code (requires the reachable AST nodes from the code generation) */
     if (reflectionData)
-    {
-        ReflectionAnalyzer reflectAnalyzer(log);
-        reflectAnalyzer.Reflect(
-            *program, inputDesc.shaderTarget, *reflectionData,
-            ((inputDesc.warnings & Warnings::CodeReflection) != 0)
-        );
-    }
+        reflectionData->relevantMacros = preProcessor->ListRelevantMacroIdents(*program);
 
     return true;
 }
@@ -262,6 +461,7 @@ XSC_EXPORT bool CompileShader(
         SortStats(reflectionData->constantBuffers);
         SortStats(reflectionData->inputAttributes);
         SortStats(reflectionData->outputAttributes);
+        SortStats(reflectionData->specConstants);
     }
 
     /* Show timings */
@@ -283,6 +483,68 @@ XSC_EXPORT bool CompileShader(
     return result;
 }
 
+XSC_EXPORT PreludePtr PrecompilePrelude(const ShaderInput& inputDesc, Log* log)
+{
+    auto SubmitError = [log](const std::string& msg)
+    {
+        if (log)
+            log->SumitReport(Report(Report::Types::Error, msg));
+        return nullptr;
+    };
+
+    /* Validate arguments */
+    if (!inputDesc.sourceCode)
+        throw std::invalid_argument(R_InputStreamCantBeNull);
+
+    if (!IsLanguageHLSL(inputDesc.shaderVersion))
+        return SubmitError(R_OnlyPreludeForHLSL);
+
+    if (inputDesc.prelude && inputDesc.prelude->shaderVersion != inputDesc.shaderVersion)
+        return SubmitError(R_PreludeShaderVersionMismatch);
+
+    /* Pre-process prelude source code */
+    std::unique_ptr<IncludeHandler> stdIncludeHandler;
+    if (!inputDesc.includeHandler)
+        stdIncludeHandler = std::unique_ptr<IncludeHandler>(new IncludeHandler());
+
+    auto includeHandler = (inputDesc.includeHandler != nullptr ? inputDesc.includeHandler : stdIncludeHandler.get());
+
+    PreProcessor preProcessor(*includeHandler, log);
+
+    auto processedInput = preProcessor.Process(
+        std::make_shared<SourceCode>(inputDesc.sourceCode),
+        inputDesc.filename,
+        true,
+        ((inputDesc.warnings & Warnings::PreProcessor) != 0),
+        inputDesc.predefinedMacros,
+        (inputDesc.prelude ? &(inputDesc.prelude->snapshot) : nullptr)
+    );
+
+    if (!processedInput)
+        return SubmitError(R_PreProcessingSourceFailed);
+
+    /* Store state of the pre-processor together with the pre-processed code */
+    std::stringstream output;
+    output << processedInput->rdbuf();
+
+    auto prelude = std::make_shared<Prelude>();
+    {
+        prelude->shaderVersion  = inputDesc.shaderVersion;
+        prelude->snapshot       = preProcessor.MakeSnapshot(output.str());
+    }
+
+    /* List prelude file in front of its included files, so it is reflected as dependency of each compilation that uses it */
+    auto& includedFiles = prelude->snapshot.includedFiles;
+
+    if (!inputDesc.filename.empty() && std::find(includedFiles.begin(), includedFiles.end(), inputDesc.filename) == includedFiles.end())
+    {
+        const auto pos = (inputDesc.prelude ? inputDesc.prelude->snapshot.includedFiles.size() : 0);
+        includedFiles.insert(includedFiles.begin() + pos, inputDesc.filename);
+    }
+
+    return prelude;
+}
+
 XSC_EXPORT std::string ToString(const ShaderTarget target)
 {
     switch (target)
@@ -8,6 +8,7 @@
 #include "Command.h"
 #include "CommandFactory.h"
 #include "Shell.h"
+#include "Server.h"
 #include "Helper.h"
 #include <Xsc/Targets.h>
 #include <Xsc/ConsoleManip.h>
@@ -257,6 +258,154 @@ void OutputCommand::Run(CommandLine& cmdLine, ShellState& state)
 }
 
 
+/*
+ * DepFileCommand class
+ */
+
+std::vector<Command::Identifier> DepFileCommand::Idents() const
+{
+    return { { "-MD" } };
+}
+
+HelpDescriptor DepFileCommand::Help() const
+{
+    return
+    {
+        "-MD",
+        "Writes a Make/Ninja dependency file for each output file; default='<OUTPUT>.d'"
+    };
+}
+
+void DepFileCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.writeDepFile = true;
+}
+
+
+/*
+ * DepFilenameCommand class
+ */
+
+std::vector<Command::Identifier> DepFilenameCommand::Idents() const
+{
+    return { { "-MF" } };
+}
+
+HelpDescriptor DepFilenameCommand::Help() const
+{
+    return
+    {
+        "-MF FILE",
+        "Dependency file for the next output file (implies -MD)"
+    };
+}
+
+void DepFilenameCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.writeDepFile  = true;
+    state.depFilename   = cmdLine.Accept();
+}
+
+
+/*
+ * PermutationsCommand class
+ */
+
+std::vector<Command::Identifier> PermutationsCommand::Idents() const
+{
+    return { { "--permutations" } };
+}
+
+HelpDescriptor PermutationsCommand::Help() const
+{
+    return
+    {
+        "--permutations FILE",
+        "Compiles all permutations of the next input file, which are described by the manifest FILE;\n"
+        "output files are deduplicated and listed in '<OUTPUT>.permutations'"
+    };
+}
+
+void PermutationsCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.permutationsFilename = cmdLine.Accept();
+}
+
+
+/*
+ * PreludeCommand class
+ */
+
+std::vector<Command::Identifier> PreludeCommand::Idents() const
+{
+    return { { "--prelude" } };
+}
+
+HelpDescriptor PreludeCommand::Help() const
+{
+    return
+    {
+        "--prelude FILE",
+        "Pre-processes FILE only once (for each set of macros) and compiles\n"
+        "all following input files as if they started with its content"
+    };
+}
+
+void PreludeCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.preludeFilename = cmdLine.Accept();
+}
+
+
+/*
+ * SaveASTCommand class
+ */
+
+std::vector<Command::Identifier> SaveASTCommand::Idents() const
+{
+    return { { "--save-ast" } };
+}
+
+HelpDescriptor SaveASTCommand::Help() const
+{
+    return
+    {
+        "--save-ast FILE",
+        "Writes the decorated AST of the next input file to FILE (in binary format)"
+    };
+}
+
+void SaveASTCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.saveASTFilename = cmdLine.Accept();
+}
+
+
+/*
+ * LoadASTCommand class
+ */
+
+std::vector<Command::Identifier> LoadASTCommand::Idents() const
+{
+    return { { "--load-ast" } };
+}
+
+HelpDescriptor LoadASTCommand::Help() const
+{
+    return
+    {
+        "--load-ast FILE",
+        "Reads the decorated AST of the next input file from FILE (see '--save-ast'),\n"
+        "and only generates the output code without compiling the input file again"
+    };
+}
+
+void LoadASTCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.loadASTFilename = cmdLine.Accept();
+}
+
+
 /*
  * IncludePathCommand class
  */
@@ -469,7 +618,7 @@ void MacroCommand::Run(CommandLine& cmdLine, ShellState& state)
     else
         macro.ident = arg;
 
-    state.predefinedMacros.push_back(macro);
+    state.inputDesc.predefinedMacros.push_back(macro);
 }
 
 
@@ -576,43 +725,44 @@ void PresettingCommand::Run(CommandLine& cmdLine, ShellState& state)
 
     auto RunPresetting = [&](Presetting& preset) -> bool
     {
-        std::cout << "run presetting: \"" << preset.title << "\"" << std::endl;
         auto shell = Shell::Instance();
+
+        const std::string headline = "run presetting: \"" + preset.title + "\"";
+        const auto numPendingJobs = shell->GetNumPendingJobs();
+
+        /* Print headline together with the output of the parallel compile job, or immediately */
+        if (state.numThreads > 1)
+            shell->SetJobHeadline(headline);
+        else
+            std::cout << headline << std::endl;
         
         bool result = false;
 
         shell->PushState();
         {
+            #ifdef XSC_ENABLE_POST_VALIDATION
+
+            /* Validate each output file with glslangValidator, also for parallel compile jobs (see Shell::PrintJob) */
+            state.postValidation = true;
+
+            #endif
+
             shell->ExecuteCommandLine(preset.cmdLine);
 
             if (!shell->GetLastOutputFilename().empty())
             {
-                #ifdef XSC_ENABLE_POST_VALIDATION
-            
-                /* Build command to run glslangValidator for the previous output file */
-                std::string cmd = "glslangValidator ";
-                
-                if (IsLanguageVKSL(shell->GetState().outputDesc.shaderVersion))
-                    cmd += "-V ";
-
-                cmd += '\"';
-                cmd += shell->GetLastOutputFilename();
-                cmd += '\"';
-
-                /* Print command to standard output */
-                if (shell->GetState().verbose)
-                    std::cout << cmd << std::endl;
-
-                /* Run command */
-                system(cmd.c_str());
-                
-                #endif
-
+                result = true;
+            }
+            else if (shell->GetNumPendingJobs() > numPendingJobs)
+            {
+                /* Failure of the parallel compile job is counted after all pending jobs are executed */
                 result = true;
             }
         }
         shell->PopState();
 
+        shell->SetJobHeadline("");
+
         state.actionPerformed = true;
 
         return result;
@@ -692,6 +842,8 @@ void PresettingCommand::Run(CommandLine& cmdLine, ShellState& state)
                     ++numFailed;
             }
 
+            numFailed += Shell::Instance()->ExecutePendingJobs();
+
             /* Print information of success or failure */
             if (numFailed == 0)
             {
@@ -725,6 +877,59 @@ void PresettingCommand::Run(CommandLine& cmdLine, ShellState& state)
 }
 
 
+/*
+ * JobsCommand class
+ */
+
+std::vector<Command::Identifier> JobsCommand::Idents() const
+{
+    return { { "-j" }, { "--jobs" } };
+}
+
+HelpDescriptor JobsCommand::Help() const
+{
+    return
+    {
+        "-j, --jobs N",
+        "Compiles up to N shader files in parallel; default=1"
+    };
+}
+
+void JobsCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    auto value = std::stoi(cmdLine.Accept());
+    if (value < 1)
+        throw std::invalid_argument("number of jobs must be greater than zero");
+    state.numThreads = static_cast<unsigned int>(value);
+}
+
+
+/*
+ * ServerCommand class
+ */
+
+std::vector<Command::Identifier> ServerCommand::Idents() const
+{
+    return { { "--server" } };
+}
+
+HelpDescriptor ServerCommand::Help() const
+{
+    return
+    {
+        "--server",
+        "Runs a compile server that reads JSON requests from stdin and writes JSON responses to stdout"
+    };
+}
+
+void ServerCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    Server server(state, std::cin, std::cout);
+    server.Run();
+    state.actionPerformed = true;
+}
+
+
 /*
  * VersionCommand class
  */
@@ -1289,6 +1494,117 @@ void SeparateShadersCommand::Run(CommandLine& cmdLine, ShellState& state)
 }
 
 
+/*
+ * PackUniformsCommand class
+ */
+
+std::vector<Command::Identifier> PackUniformsCommand::Idents() const
+{
+    return { { "--pack-uniforms" } };
+}
+
+HelpDescriptor PackUniformsCommand::Help() const
+{
+    return
+    {
+        "--pack-uniforms [" + CommandLine::GetBooleanOption() + "]",
+        "Packs constant buffers into 'vec4' arrays for GLSL 1.10 - 1.30 and ESSL 1.00; default=" + CommandLine::GetBooleanFalse()
+    };
+}
+
+void PackUniformsCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.packUniforms = cmdLine.AcceptBoolean(true);
+}
+
+
+/*
+ * PrecisionCommand class
+ */
+
+std::vector<Command::Identifier> PrecisionCommand::Idents() const
+{
+    return { { "--precision" } };
+}
+
+HelpDescriptor PrecisionCommand::Help() const
+{
+    return
+    {
+        "--precision MODE",
+        "Precision qualifier inference for ESSL output; default=off; valid modes:",
+        (
+            "off          => 'half' types are mediump, all other floating-point types are highp\n" \
+            "conservative => like 'off', but values for vertex positions or texture coordinates are highp\n" \
+            "aggressive   => like 'conservative', but local 'float' variables with only 'half' values are mediump"
+        )
+    };
+}
+
+void PrecisionCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.precisionInference = MapStringToType<PrecisionInference>(
+        cmdLine.Accept(),
+        {
+            { "off",          PrecisionInference::Disabled     },
+            { "conservative", PrecisionInference::Conservative },
+            { "aggressive",   PrecisionInference::Aggressive   },
+        },
+        "invalid precision inference mode"
+    );
+}
+
+
+/*
+ * PushConstantLimitCommand class
+ */
+
+std::vector<Command::Identifier> PushConstantLimitCommand::Idents() const
+{
+    return { { "--push-constant-limit" } };
+}
+
+HelpDescriptor PushConstantLimitCommand::Help() const
+{
+    return
+    {
+        "--push-constant-limit SIZE",
+        "Maximal size (in bytes) of a '[vk::push_constant]' cbuffer to be a push constant block for VKSL output; default=128",
+        "A size of 0 disables push constant blocks"
+    };
+}
+
+void PushConstantLimitCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.pushConstantLimit = static_cast<unsigned int>(std::stoul(cmdLine.Accept()));
+}
+
+
+/*
+ * PipelineCommand class
+ */
+
+std::vector<Command::Identifier> PipelineCommand::Idents() const
+{
+    return { { "--pipeline" } };
+}
+
+HelpDescriptor PipelineCommand::Help() const
+{
+    return
+    {
+        "--pipeline [" + CommandLine::GetBooleanOption() + "]",
+        "Runs pre-processing and parsing simultaneously on two threads; default=" + CommandLine::GetBooleanFalse(),
+        "Includes are handled on the worker thread of the pre-processor"
+    };
+}
+
+void PipelineCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.pipelinedFrontend = cmdLine.AcceptBoolean(true);
+}
+
+
 
 } // /namespace Util
 
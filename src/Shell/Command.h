@@ -74,6 +74,12 @@ DECL_SHELL_COMMAND( TargetCommand                );
 DECL_SHELL_COMMAND( VersionInCommand             );
 DECL_SHELL_COMMAND( VersionOutCommand            );
 DECL_SHELL_COMMAND( OutputCommand                );
+DECL_SHELL_COMMAND( DepFileCommand               );
+DECL_SHELL_COMMAND( DepFilenameCommand           );
+DECL_SHELL_COMMAND( PermutationsCommand          );
+DECL_SHELL_COMMAND( PreludeCommand               );
+DECL_SHELL_COMMAND( SaveASTCommand               );
+DECL_SHELL_COMMAND( LoadASTCommand               );
 DECL_SHELL_COMMAND( IncludePathCommand           );
 DECL_SHELL_COMMAND( WarnCommand                  );
 DECL_SHELL_COMMAND( ShowASTCommand               );
@@ -84,6 +90,8 @@ DECL_SHELL_COMMAND( MacroCommand                 );
 DECL_SHELL_COMMAND( SemanticCommand              );
 DECL_SHELL_COMMAND( PauseCommand                 );
 DECL_SHELL_COMMAND( PresettingCommand            );
+DECL_SHELL_COMMAND( JobsCommand                  );
+DECL_SHELL_COMMAND( ServerCommand                );
 DECL_SHELL_COMMAND( VersionCommand               );
 DECL_SHELL_COMMAND( HelpCommand                  );
 DECL_SHELL_COMMAND( VerboseCommand               );
@@ -105,6 +113,10 @@ DECL_SHELL_COMMAND( IndentCommand                );
 DECL_SHELL_COMMAND( PrefixCommand                );
 DECL_SHELL_COMMAND( NameManglingCommand          );
 DECL_SHELL_COMMAND( SeparateShadersCommand       );
+DECL_SHELL_COMMAND( PackUniformsCommand          );
+DECL_SHELL_COMMAND( PrecisionCommand             );
+DECL_SHELL_COMMAND( PushConstantLimitCommand     );
+DECL_SHELL_COMMAND( PipelineCommand              );
 
 #undef DECL_SHELL_COMMAND
 
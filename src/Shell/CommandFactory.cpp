@@ -58,6 +58,12 @@ CommandFactory::CommandFactory()
         IncludePathCommand,
 
         OutputCommand,
+        DepFileCommand,
+        DepFilenameCommand,
+        PermutationsCommand,
+        PreludeCommand,
+        SaveASTCommand,
+        LoadASTCommand,
         WarnCommand,
         ShowASTCommand,
         ShowTimesCommand,
@@ -67,6 +73,8 @@ CommandFactory::CommandFactory()
         SemanticCommand,
         PauseCommand,
         PresettingCommand,
+        JobsCommand,
+        ServerCommand,
         VersionCommand,
         HelpCommand,
         VerboseCommand,
@@ -87,7 +95,11 @@ CommandFactory::CommandFactory()
         IndentCommand,
         PrefixCommand,
         NameManglingCommand,
-        SeparateShadersCommand
+        SeparateShadersCommand,
+        PackUniformsCommand,
+        PrecisionCommand,
+        PushConstantLimitCommand,
+        PipelineCommand
     >();
 }
 
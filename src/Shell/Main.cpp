@@ -48,6 +48,8 @@ int main(int argc, char** argv)
                 CommandLine cmdLine(line);
                 if (shell.ExecuteCommandLine(cmdLine, false))
                     actionPerformed = true;
+
+                shell.ExecutePendingJobs();
             }
         }
     }
@@ -57,6 +59,11 @@ int main(int argc, char** argv)
     if (shell.ExecuteCommandLine(cmdLine, !actionPerformed))
         actionPerformed = true;
 
+    /* Compile all pending jobs (if parallel compilation is enabled) */
+    shell.ExecutePendingJobs();
+
+    shell.PrintOutputSummary();
+
     /* Print hint if no action has been performed */
     if (!actionPerformed)
         std::cout << "no action performed" << std::endl;
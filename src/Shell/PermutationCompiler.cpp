@@ -0,0 +1,458 @@
+/*
+ * PermutationCompiler.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "PermutationCompiler.h"
+#include "Shell.h"
+#include <Xsc/Xsc.h>
+#include <sstream>
+#include <fstream>
+#include <stdexcept>
+#include <algorithm>
+#include <unordered_map>
+#include <map>
+
+
+namespace Xsc
+{
+
+namespace Util
+{
+
+
+/*
+ * Internal functions
+ */
+
+static std::string GetPathPart(const std::string& s)
+{
+    const auto pos = s.find_last_of("\\/");
+    return (pos == std::string::npos ? "" : s.substr(0, pos));
+}
+
+static bool IsUndefinedMacroValue(const std::string& value)
+{
+    return (value == "-");
+}
+
+
+/*
+ * PermutationManifest structure
+ */
+
+void PermutationManifest::Load(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if (!file.good())
+        throw std::runtime_error("failed to read file: \"" + filename + "\"");
+
+    axes.clear();
+    exclusions.clear();
+
+    std::size_t lineNo = 0;
+
+    auto Error = [&](const std::string& msg)
+    {
+        throw std::runtime_error(msg + " (" + filename + ":" + std::to_string(lineNo) + ")");
+    };
+
+    while (!file.eof())
+    {
+        std::string line;
+        std::getline(file, line);
+        ++lineNo;
+
+        /* Remove comment and split line into words */
+        const auto commentPos = line.find('#');
+        if (commentPos != std::string::npos)
+            line.resize(commentPos);
+
+        std::vector<std::string> words;
+        {
+            std::stringstream stream(line);
+            std::string word;
+            while (stream >> word)
+                words.push_back(word);
+        }
+
+        if (words.empty())
+            continue;
+
+        if (words[0] == "axis")
+        {
+            /* Parse macro axis */
+            if (words.size() < 3)
+                Error("missing values in permutation axis");
+
+            PermutationAxis axis;
+            axis.ident = words[1];
+            axis.values.assign(words.begin() + 2, words.end());
+
+            for (const auto& otherAxis : axes)
+            {
+                if (otherAxis.ident == axis.ident)
+                    Error("duplicate permutation axis \"" + axis.ident + "\"");
+            }
+
+            axes.emplace_back(std::move(axis));
+        }
+        else if (words[0] == "exclude")
+        {
+            /* Parse exclusion with macro assignments "IDENT=VALUE" */
+            if (words.size() < 2)
+                Error("missing macro values in permutation exclusion");
+
+            std::vector<PredefinedMacro> exclusion;
+
+            for (std::size_t i = 1; i < words.size(); ++i)
+            {
+                const auto assignPos = words[i].find('=');
+                if (assignPos == std::string::npos)
+                    Error("expected assignment \"IDENT=VALUE\" in permutation exclusion, but got \"" + words[i] + "\"");
+
+                PredefinedMacro macro;
+                macro.ident = words[i].substr(0, assignPos);
+                macro.value = words[i].substr(assignPos + 1);
+
+                /* Validate macro assignment against the previously declared axes */
+                auto axisIt = std::find_if(
+                    axes.begin(), axes.end(),
+                    [&macro](const PermutationAxis& axis)
+                    {
+                        return (axis.ident == macro.ident);
+                    }
+                );
+
+                if (axisIt == axes.end())
+                    Error("unknown permutation axis \"" + macro.ident + "\" in permutation exclusion");
+
+                if (std::find(axisIt->values.begin(), axisIt->values.end(), macro.value) == axisIt->values.end())
+                    Error("unknown value \"" + macro.value + "\" of permutation axis \"" + macro.ident + "\" in permutation exclusion");
+
+                exclusion.emplace_back(std::move(macro));
+            }
+
+            exclusions.emplace_back(std::move(exclusion));
+        }
+        else
+            Error("unknown permutation manifest statement \"" + words[0] + "\"");
+    }
+
+    if (axes.empty())
+        throw std::runtime_error("no permutation axes specified in manifest: \"" + filename + "\"");
+}
+
+
+/*
+ * CachedIncludeHandler class
+ */
+
+class PermutationCompiler::CachedIncludeHandler : public IncludeHandler
+{
+
+    public:
+
+        std::unique_ptr<std::istream> Include(const std::string& filename, bool useSearchPathsFirst) override
+        {
+            const auto resolvedPath = ResolvePath(filename, useSearchPathsFirst);
+
+            if (!resolvedPath.empty())
+            {
+                /* Read file only once for all permutations */
+                auto it = files_.find(resolvedPath);
+                if (it == files_.end())
+                {
+                    std::ifstream file(resolvedPath);
+                    if (!file.good())
+                        throw std::runtime_error("failed to include file: \"" + filename + "\"");
+
+                    std::stringstream content;
+                    content << file.rdbuf();
+
+                    it = files_.insert({ resolvedPath, content.str() }).first;
+                }
+
+                ReportIncludedPath(resolvedPath);
+
+                return std::unique_ptr<std::istream>(new std::stringstream(it->second));
+            }
+
+            throw std::runtime_error("failed to include file: \"" + filename + "\"");
+        }
+
+        std::string ResolvePath(const std::string& filename, bool useSearchPathsFirst) override
+        {
+            /* Resolve each include filename only once, since the search paths are the same for all permutations */
+            const auto key = std::make_pair(filename, useSearchPathsFirst);
+
+            auto it = resolvedPaths_.find(key);
+            if (it == resolvedPaths_.end())
+                it = resolvedPaths_.insert({ key, IncludeHandler::ResolvePath(filename, useSearchPathsFirst) }).first;
+
+            return it->second;
+        }
+
+    private:
+
+        std::map<std::string, std::string>                      files_;
+        std::map<std::pair<std::string, bool>, std::string>     resolvedPaths_;
+
+};
+
+
+/*
+ * PermutationCompiler class
+ */
+
+PermutationCompiler::PermutationCompiler(std::ostream& output) :
+    output_ { output }
+{
+}
+
+bool PermutationCompiler::Compile(
+    const ShellState&           state,
+    const PermutationManifest&  manifest,
+    const std::string&          filename,
+    const std::string&          outputFilename)
+{
+    /* Read input file only once for all permutations */
+    std::string sourceCode;
+    {
+        std::ifstream inputFile(filename);
+        if (!inputFile.good())
+            throw std::runtime_error("failed to read file: \"" + filename + "\"");
+
+        std::stringstream content;
+        content << inputFile.rdbuf();
+        sourceCode = content.str();
+    }
+
+    CachedIncludeHandler includeHandler;
+
+    includeHandler.searchPaths = state.searchPaths;
+
+    const auto inputPath = GetPathPart(filename);
+    if (!inputPath.empty())
+        includeHandler.searchPaths.push_back(inputPath);
+
+    auto permutations = EnumeratePermutations(manifest);
+
+    if (state.verbose)
+        output_ << "compile " << permutations.size() << " permutations of \"" << filename << '\"' << std::endl;
+
+    /* Preprocess all permutations and collapse the ones with identical preprocessed code */
+    std::unordered_map<std::string, std::size_t>    uniqueCodeIndices;
+    std::vector<const std::string*>                 uniqueCodes;
+    std::size_t                                     numFailed       = 0;
+
+    for (auto& perm : permutations)
+    {
+        std::stringstream preprocessedCode;
+
+        ShaderInput inputDesc = state.inputDesc;
+        inputDesc.filename          = filename;
+        inputDesc.sourceCode        = std::make_shared<std::stringstream>(sourceCode);
+        inputDesc.includeHandler    = &includeHandler;
+
+        inputDesc.predefinedMacros.insert(inputDesc.predefinedMacros.end(), perm.macros.begin(), perm.macros.end());
+
+        ShaderOutput outputDesc = state.outputDesc;
+        outputDesc.sourceCode               = &preprocessedCode;
+        outputDesc.options.preprocessOnly   = true;
+
+        StdLog log;
+
+        if (CompileShader(inputDesc, outputDesc, &log))
+        {
+            auto it = uniqueCodeIndices.find(preprocessedCode.str());
+            if (it == uniqueCodeIndices.end())
+            {
+                it = uniqueCodeIndices.insert({ preprocessedCode.str(), uniqueCodes.size() }).first;
+                uniqueCodes.push_back(&(it->first));
+            }
+            perm.outputIndex = it->second;
+        }
+        else
+        {
+            output_ << "preprocessing permutation \"" << perm.key << "\" failed" << std::endl;
+            log.PrintAll(state.verbose);
+            perm.outputIndex = ~0u;
+            ++numFailed;
+        }
+    }
+
+    /* Compile each unique preprocessed code only once */
+    std::vector<bool> uniqueResults(uniqueCodes.size(), false);
+
+    for (std::size_t i = 0; i < uniqueCodes.size(); ++i)
+    {
+        const auto uniqueOutputFilename = GetPermutationOutputFilename(outputFilename, i);
+
+        std::stringstream outputStream;
+
+        ShaderInput inputDesc = state.inputDesc;
+        inputDesc.filename          = filename;
+        inputDesc.sourceCode        = std::make_shared<std::stringstream>(*uniqueCodes[i]);
+        inputDesc.includeHandler    = &includeHandler;
+        inputDesc.predefinedMacros.clear();
+        inputDesc.prelude = nullptr;
+
+        ShaderOutput outputDesc = state.outputDesc;
+        outputDesc.sourceCode = &outputStream;
+
+        StdLog log;
+
+        if (state.verbose && !state.outputDesc.options.validateOnly)
+            output_ << "compile unique permutation " << i << " to \"" << uniqueOutputFilename << '\"' << std::endl;
+
+        uniqueResults[i] = CompileShader(inputDesc, outputDesc, &log);
+
+        log.PrintAll(state.verbose);
+
+        if (uniqueResults[i])
+        {
+            if (!state.outputDesc.options.validateOnly)
+                Shell::WriteFileIfChanged(uniqueOutputFilename, outputStream.str());
+        }
+        else
+            output_ << "compilation of unique permutation " << i << " failed" << std::endl;
+    }
+
+    /* Write index file from permutation keys to deduplicated output filenames */
+    std::stringstream index;
+
+    for (const auto& perm : permutations)
+    {
+        if (perm.outputIndex < uniqueResults.size() && uniqueResults[perm.outputIndex])
+            index << perm.key << ": " << GetPermutationOutputFilename(outputFilename, perm.outputIndex) << std::endl;
+        else
+        {
+            index << perm.key << ": <failed>" << std::endl;
+            if (perm.outputIndex < uniqueResults.size())
+                ++numFailed;
+        }
+    }
+
+    if (!state.outputDesc.options.validateOnly)
+        Shell::WriteFileIfChanged(outputFilename + ".permutations", index.str());
+
+    if (state.verbose)
+    {
+        output_ << permutations.size() << " permutations collapsed to " << uniqueCodes.size() << " unique outputs";
+        if (numFailed > 0)
+            output_ << " (" << numFailed << " failed)";
+        output_ << std::endl;
+    }
+
+    return (numFailed == 0);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::vector<PermutationCompiler::Permutation> PermutationCompiler::EnumeratePermutations(const PermutationManifest& manifest)
+{
+    std::vector<Permutation> permutations;
+
+    /* Iterate over all combinations of axis values (the last axis changes fastest) */
+    std::vector<std::size_t> valueIndices(manifest.axes.size(), 0);
+
+    auto IsExcluded = [&]()
+    {
+        for (const auto& exclusion : manifest.exclusions)
+        {
+            bool matchesAll = true;
+
+            for (const auto& macro : exclusion)
+            {
+                bool matches = false;
+
+                for (std::size_t i = 0; i < manifest.axes.size(); ++i)
+                {
+                    const auto& axis = manifest.axes[i];
+                    if (axis.ident == macro.ident && axis.values[valueIndices[i]] == macro.value)
+                    {
+                        matches = true;
+                        break;
+                    }
+                }
+
+                if (!matches)
+                {
+                    matchesAll = false;
+                    break;
+                }
+            }
+
+            if (matchesAll)
+                return true;
+        }
+        return false;
+    };
+
+    while (true)
+    {
+        if (!IsExcluded())
+        {
+            /* Add permutation for current combination */
+            Permutation perm;
+
+            for (std::size_t i = 0; i < manifest.axes.size(); ++i)
+            {
+                const auto& axis    = manifest.axes[i];
+                const auto& value   = axis.values[valueIndices[i]];
+
+                if (!perm.key.empty())
+                    perm.key += ' ';
+                perm.key += axis.ident + "=" + value;
+
+                if (!IsUndefinedMacroValue(value))
+                    perm.macros.push_back({ axis.ident, value });
+            }
+
+            permutations.emplace_back(std::move(perm));
+        }
+
+        /* Move to next combination */
+        auto i = manifest.axes.size();
+
+        while (i > 0)
+        {
+            --i;
+            if (++valueIndices[i] < manifest.axes[i].values.size())
+                break;
+            valueIndices[i] = 0;
+            if (i == 0)
+                return permutations;
+        }
+
+        if (manifest.axes.empty())
+            return permutations;
+    }
+}
+
+std::string PermutationCompiler::GetPermutationOutputFilename(const std::string& outputFilename, std::size_t index)
+{
+    /* Insert index in front of the file extension (e.g. "Example.main.frag" -> "Example.main.0.frag") */
+    const auto extPos   = outputFilename.find_last_of('.');
+    const auto pathPos  = outputFilename.find_last_of("\\/");
+
+    if (extPos == std::string::npos || (pathPos != std::string::npos && extPos < pathPos))
+        return outputFilename + "." + std::to_string(index);
+    else
+        return outputFilename.substr(0, extPos) + "." + std::to_string(index) + outputFilename.substr(extPos);
+}
+
+
+} // /namespace Util
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,102 @@
+/*
+ * PermutationCompiler.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_PERMUTATION_COMPILER_H
+#define XSC_PERMUTATION_COMPILER_H
+
+
+#include "ShellState.h"
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+namespace Xsc
+{
+
+namespace Util
+{
+
+
+// Macro axis of a permutation manifest.
+struct PermutationAxis
+{
+    std::string                 ident;
+    std::vector<std::string>    values; // Macro values of this axis, where "-" leaves the macro undefined.
+};
+
+/*
+Shader permutation manifest (see "--permutations" command).
+Each line of the manifest file contains one statement, and '#' starts a comment:
+  axis USE_FOG 0 1                  -> each permutation defines "USE_FOG" either as "0" or "1"
+  axis USE_SHADOWS - 1              -> '-' leaves the macro undefined
+  exclude USE_FOG=0 USE_SHADOWS=1   -> skips all permutations that match all of these values (axes must be declared before)
+*/
+struct PermutationManifest
+{
+    // Loads the manifest from the specified file, or throws an exception on failure.
+    void Load(const std::string& filename);
+
+    std::vector<PermutationAxis>                axes;
+    std::vector<std::vector<PredefinedMacro>>   exclusions;
+};
+
+/*
+Compiles all permutations of a shader file that are described by a permutation manifest.
+Each permutation is preprocessed first (with a shared cache for all included files),
+and permutations with identical preprocessed code are collapsed before parsing, so each unique code is compiled only once.
+The output files are named "<OUTPUT-NAME>.<N>.<OUTPUT-EXT>", and the index file "<OUTPUT>.permutations"
+lists each permutation key together with the filename of its deduplicated output.
+*/
+class PermutationCompiler
+{
+
+    public:
+
+        PermutationCompiler(std::ostream& output);
+
+        // Compiles all permutations of the specified file and returns true on success.
+        bool Compile(
+            const ShellState&           state,
+            const PermutationManifest&  manifest,
+            const std::string&          filename,
+            const std::string&          outputFilename
+        );
+
+    private:
+
+        struct Permutation
+        {
+            std::string                     key;            // Permutation key, e.g. "USE_FOG=0 USE_SHADOWS=-".
+            std::vector<PredefinedMacro>    macros;         // Macros that are defined for this permutation.
+            std::size_t                     outputIndex = 0;
+        };
+
+        // Returns all permutations of the specified manifest, except the excluded ones.
+        static std::vector<Permutation> EnumeratePermutations(const PermutationManifest& manifest);
+
+        // Returns the filename of the deduplicated output with the specified index.
+        static std::string GetPermutationOutputFilename(const std::string& outputFilename, std::size_t index);
+
+        // Include handler that reads each included file only once for all permutations.
+        class CachedIncludeHandler;
+
+        std::ostream& output_;
+
+};
+
+
+} // /namespace Util
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
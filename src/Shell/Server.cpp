@@ -0,0 +1,844 @@
+/*
+ * Server.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Server.h"
+#include "CommandFactory.h"
+#include "Shell.h"
+#include "Helper.h"
+#include <Xsc/Xsc.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sstream>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <algorithm>
+#include <cctype>
+
+
+namespace Xsc
+{
+
+namespace Util
+{
+
+
+/*
+ * Internal functions
+ */
+
+static void SkipJsonWhitespaces(const std::string& s, std::size_t& pos)
+{
+    while (pos < s.size() && (s[pos] == ' ' || s[pos] == '\t' || s[pos] == '\r' || s[pos] == '\n'))
+        ++pos;
+}
+
+static void AcceptJsonChar(const std::string& s, std::size_t& pos, char c)
+{
+    SkipJsonWhitespaces(s, pos);
+    if (pos >= s.size() || s[pos] != c)
+        throw std::runtime_error(std::string("invalid JSON request: expected '") + c + "'");
+    ++pos;
+}
+
+static bool IsJsonChar(const std::string& s, std::size_t& pos, char c)
+{
+    SkipJsonWhitespaces(s, pos);
+    return (pos < s.size() && s[pos] == c);
+}
+
+static void AppendUTF8(std::string& s, unsigned int codePoint)
+{
+    if (codePoint < 0x80)
+        s += static_cast<char>(codePoint);
+    else if (codePoint < 0x800)
+    {
+        s += static_cast<char>(0xC0 | (codePoint >> 6));
+        s += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else
+    {
+        s += static_cast<char>(0xE0 | (codePoint >> 12));
+        s += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        s += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
+
+static std::string ParseJsonString(const std::string& s, std::size_t& pos)
+{
+    AcceptJsonChar(s, pos, '\"');
+
+    std::string value;
+
+    while (pos < s.size() && s[pos] != '\"')
+    {
+        auto c = s[pos++];
+
+        if (c == '\\' && pos < s.size())
+        {
+            /* Parse escape character */
+            c = s[pos++];
+            switch (c)
+            {
+                case 'b': value += '\b'; break;
+                case 'f': value += '\f'; break;
+                case 'n': value += '\n'; break;
+                case 'r': value += '\r'; break;
+                case 't': value += '\t'; break;
+                case 'u':
+                {
+                    if (pos + 4 > s.size())
+                        throw std::runtime_error("invalid JSON request: incomplete unicode escape sequence");
+                    AppendUTF8(value, static_cast<unsigned int>(std::stoul(s.substr(pos, 4), nullptr, 16)));
+                    pos += 4;
+                }
+                break;
+                default: value += c; break;
+            }
+        }
+        else
+            value += c;
+    }
+
+    AcceptJsonChar(s, pos, '\"');
+
+    return value;
+}
+
+// Returns true if the specified string is a valid JSON number (e.g. "-1.5e+3").
+static bool IsJsonNumber(const std::string& s)
+{
+    std::size_t i = 0;
+
+    auto IsDigit = [&s, &i]()
+    {
+        return (i < s.size() && std::isdigit(static_cast<unsigned char>(s[i])) != 0);
+    };
+
+    auto SkipDigits = [&]()
+    {
+        if (!IsDigit())
+            return false;
+        while (IsDigit())
+            ++i;
+        return true;
+    };
+
+    /* Parse integral part (leading zeros are not allowed) */
+    if (i < s.size() && s[i] == '-')
+        ++i;
+
+    if (i < s.size() && s[i] == '0')
+        ++i;
+    else if (!SkipDigits())
+        return false;
+
+    /* Parse optional fraction */
+    if (i < s.size() && s[i] == '.')
+    {
+        ++i;
+        if (!SkipDigits())
+            return false;
+    }
+
+    /* Parse optional exponent */
+    if (i < s.size() && (s[i] == 'e' || s[i] == 'E'))
+    {
+        ++i;
+        if (i < s.size() && (s[i] == '+' || s[i] == '-'))
+            ++i;
+        if (!SkipDigits())
+            return false;
+    }
+
+    return (i == s.size());
+}
+
+// Parses a number, 'true', 'false', or 'null' and returns it as raw string.
+static std::string ParseJsonLiteral(const std::string& s, std::size_t& pos)
+{
+    SkipJsonWhitespaces(s, pos);
+
+    const auto start = pos;
+    while (pos < s.size() && (std::isalnum(static_cast<unsigned char>(s[pos])) || s[pos] == '-' || s[pos] == '+' || s[pos] == '.'))
+        ++pos;
+
+    if (start == pos)
+        throw std::runtime_error("invalid JSON request: unexpected character");
+
+    /* Only accept valid literals, since they are written back unchanged (e.g. as request ID) */
+    auto literal = s.substr(start, pos - start);
+
+    if (literal != "true" && literal != "false" && literal != "null" && !IsJsonNumber(literal))
+        throw std::runtime_error("invalid JSON request: invalid literal '" + literal + "'");
+
+    return literal;
+}
+
+static void SkipJsonValue(const std::string& s, std::size_t& pos)
+{
+    if (IsJsonChar(s, pos, '\"'))
+        ParseJsonString(s, pos);
+    else if (IsJsonChar(s, pos, '[') || IsJsonChar(s, pos, '{'))
+    {
+        const auto closeChar = (s[pos] == '[' ? ']' : '}');
+        ++pos;
+
+        while (!IsJsonChar(s, pos, closeChar))
+        {
+            if (closeChar == '}')
+            {
+                ParseJsonString(s, pos);
+                AcceptJsonChar(s, pos, ':');
+            }
+
+            SkipJsonValue(s, pos);
+
+            if (!IsJsonChar(s, pos, closeChar))
+                AcceptJsonChar(s, pos, ',');
+        }
+
+        ++pos;
+    }
+    else
+        ParseJsonLiteral(s, pos);
+}
+
+static void AppendJsonString(std::string& s, const std::string& value)
+{
+    static const char* hexDigits = "0123456789abcdef";
+
+    s += '\"';
+
+    for (auto c : value)
+    {
+        switch (c)
+        {
+            case '\"': s += "\\\""; break;
+            case '\\': s += "\\\\"; break;
+            case '\b': s += "\\b";  break;
+            case '\f': s += "\\f";  break;
+            case '\n': s += "\\n";  break;
+            case '\r': s += "\\r";  break;
+            case '\t': s += "\\t";  break;
+            default:
+            {
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    s += "\\u00";
+                    s += hexDigits[(c >> 4) & 0x0F];
+                    s += hexDigits[c & 0x0F];
+                }
+                else
+                    s += c;
+            }
+            break;
+        }
+    }
+
+    s += '\"';
+}
+
+static const char* ReportTypeToString(const Report::Types type)
+{
+    switch (type)
+    {
+        case Report::Types::Info:       return "info";
+        case Report::Types::Warning:    return "warning";
+        case Report::Types::Error:      return "error";
+    }
+    return "";
+}
+
+// Returns the modification time (in nanoseconds) and size of the specified file.
+static bool GetFileStamp(const std::string& filename, long long& modTime, long long& size)
+{
+    struct stat fileStatus;
+    if (stat(filename.c_str(), &fileStatus) == 0 && (fileStatus.st_mode & S_IFREG) != 0)
+    {
+        /* Use nanosecond precision where available, so modifications within the same second are detected */
+        #if defined _WIN32
+        modTime = static_cast<long long>(fileStatus.st_mtime) * 1000000000ll;
+        #elif defined __APPLE__
+        modTime = static_cast<long long>(fileStatus.st_mtimespec.tv_sec) * 1000000000ll + fileStatus.st_mtimespec.tv_nsec;
+        #else
+        modTime = static_cast<long long>(fileStatus.st_mtim.tv_sec) * 1000000000ll + fileStatus.st_mtim.tv_nsec;
+        #endif
+        size    = static_cast<long long>(fileStatus.st_size);
+        return true;
+    }
+    return false;
+}
+
+// Returns the path without its filename from the specified string.
+static std::string GetPathPart(const std::string& s)
+{
+    const auto pos = s.find_last_of("\\/");
+    return (pos == std::string::npos ? "" : s.substr(0, pos));
+}
+
+// Log that collects all reports as JSON objects.
+class ServerLog : public Log
+{
+
+    public:
+
+        void SumitReport(const Report& report) override
+        {
+            if (!reports.empty())
+                reports += ',';
+
+            reports += "{\"type\":";
+            AppendJsonString(reports, ReportTypeToString(report.Type()));
+            reports += ",\"message\":";
+            AppendJsonString(reports, FullIndent() + report.Message());
+
+            if (!report.Context().empty())
+            {
+                reports += ",\"context\":";
+                AppendJsonString(reports, report.Context());
+            }
+
+            if (report.HasLine())
+            {
+                reports += ",\"line\":";
+                AppendJsonString(reports, report.Line());
+                reports += ",\"marker\":";
+                AppendJsonString(reports, report.Marker());
+            }
+
+            if (!report.GetHints().empty())
+            {
+                reports += ",\"hints\":[";
+                for (std::size_t i = 0; i < report.GetHints().size(); ++i)
+                {
+                    if (i > 0)
+                        reports += ',';
+                    AppendJsonString(reports, report.GetHints()[i]);
+                }
+                reports += ']';
+            }
+
+            reports += '}';
+        }
+
+        std::string reports;
+
+};
+
+
+/*
+ * CachedIncludeHandler class
+ */
+
+class Server::CachedIncludeHandler : public IncludeHandler
+{
+
+    public:
+
+        CachedIncludeHandler(Server& server, FileDependencies& dependencies) :
+            server_         { server       },
+            dependencies_   { dependencies }
+        {
+        }
+
+        std::unique_ptr<std::istream> Include(const std::string& filename, bool useSearchPathsFirst) override
+        {
+            /* Try relative path and all search paths in the same order as the default include handler */
+            std::vector<std::string> candidates;
+
+            if (!useSearchPathsFirst)
+                candidates.push_back(filename);
+
+            for (const auto& path : searchPaths)
+            {
+                if (!path.empty())
+                {
+                    std::string s = path;
+                    if (path.back() != '/' && path.back() != '\\')
+                        s += '/';
+                    candidates.push_back(s + filename);
+                }
+            }
+
+            if (useSearchPathsFirst)
+                candidates.push_back(filename);
+
+            for (const auto& candidate : candidates)
+            {
+                std::string content;
+                FileStamp stamp;
+
+                if (server_.ReadCachedFile(candidate, content, stamp))
+                {
+                    dependencies_[candidate] = stamp;
+                    ReportIncludedPath(candidate);
+                    return std::unique_ptr<std::istream>(new std::stringstream(content));
+                }
+            }
+
+            throw std::runtime_error("failed to include file: \"" + filename + "\"");
+        }
+
+    private:
+
+        Server&             server_;
+        FileDependencies&   dependencies_;
+
+};
+
+
+/*
+ * Server class
+ */
+
+Server::Server(const ShellState& defaultState, std::istream& input, std::ostream& output) :
+    defaultState_   { defaultState },
+    input_          { input        },
+    output_         { output       }
+{
+}
+
+void Server::Run()
+{
+    /* Start worker threads (use all hardware threads, if the number of jobs has not been specified) */
+    auto numThreads = defaultState_.numThreads;
+
+    if (numThreads <= 1)
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+
+    for (unsigned int i = 0; i < numThreads; ++i)
+        threads.emplace_back(&Server::WorkerThread, this);
+
+    /* Read requests line by line */
+    std::string line;
+
+    while (std::getline(input_, line))
+    {
+        if (line.find_first_not_of(" \t\r") == std::string::npos)
+            continue;
+
+        /* Stop reading on shutdown request, but finish all pending requests */
+        if (line.find("\"shutdown\"") != std::string::npos)
+        {
+            Request request;
+            try
+            {
+                ParseRequest(line, request);
+            }
+            catch (const std::exception&)
+            {
+            }
+
+            if (request.command == "shutdown")
+                break;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard { requestMutex_ };
+            requestQueue_.push_back(line);
+        }
+        requestCondition_.notify_one();
+    }
+
+    /* Wait until all pending requests are processed */
+    {
+        std::lock_guard<std::mutex> guard { requestMutex_ };
+        inputClosed_ = true;
+    }
+    requestCondition_.notify_all();
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void Server::WorkerThread()
+{
+    while (true)
+    {
+        std::string line;
+        {
+            std::unique_lock<std::mutex> lock { requestMutex_ };
+            requestCondition_.wait(lock, [this]() { return (!requestQueue_.empty() || inputClosed_); });
+
+            if (requestQueue_.empty())
+                return;
+
+            line = std::move(requestQueue_.front());
+            requestQueue_.pop_front();
+        }
+        ProcessRequest(line);
+    }
+}
+
+void Server::ParseRequest(const std::string& line, Request& request)
+{
+    std::size_t pos = 0;
+
+    AcceptJsonChar(line, pos, '{');
+
+    while (!IsJsonChar(line, pos, '}'))
+    {
+        auto key = ParseJsonString(line, pos);
+        AcceptJsonChar(line, pos, ':');
+
+        if (key == "id")
+        {
+            if (IsJsonChar(line, pos, '\"'))
+            {
+                request.id.clear();
+                AppendJsonString(request.id, ParseJsonString(line, pos));
+            }
+            else
+                request.id = ParseJsonLiteral(line, pos);
+        }
+        else if (key == "command")
+            request.command = ParseJsonString(line, pos);
+        else if (key == "args")
+        {
+            if (IsJsonChar(line, pos, '['))
+            {
+                /* Parse arguments from string array */
+                ++pos;
+                while (!IsJsonChar(line, pos, ']'))
+                {
+                    request.args.push_back(ParseJsonString(line, pos));
+                    if (!IsJsonChar(line, pos, ']'))
+                        AcceptJsonChar(line, pos, ',');
+                }
+                ++pos;
+            }
+            else
+            {
+                /* Parse arguments from single string like a command line */
+                CommandLine cmdLine(ParseJsonString(line, pos));
+                while (!cmdLine.ReachedEnd())
+                    request.args.push_back(cmdLine.Accept());
+            }
+            request.hasArgs = true;
+        }
+        else if (key == "source")
+        {
+            request.source      = ParseJsonString(line, pos);
+            request.hasSource   = true;
+        }
+        else
+            SkipJsonValue(line, pos);
+
+        if (!IsJsonChar(line, pos, '}'))
+            AcceptJsonChar(line, pos, ',');
+    }
+}
+
+void Server::ProcessRequest(const std::string& line)
+{
+    Request request;
+
+    try
+    {
+        ParseRequest(line, request);
+
+        /* Process server command */
+        if (!request.command.empty())
+        {
+            if (request.command == "clear-cache")
+            {
+                ClearCaches();
+                WriteResponse(request.id, "\"success\":true");
+            }
+            else
+                throw std::runtime_error("unknown server command: \"" + request.command + "\"");
+            return;
+        }
+
+        if (!request.hasArgs)
+            throw std::runtime_error("missing \"args\" in compile request");
+
+        /* Build cache key from arguments and source code */
+        std::string cacheKey;
+        for (const auto& arg : request.args)
+            AppendJsonString(cacheKey, arg);
+
+        if (request.hasSource)
+            AppendJsonString(cacheKey, request.source);
+
+        /* Find response in cache or compile the request */
+        std::string response;
+
+        if (!FindCachedResponse(cacheKey, response))
+        {
+            FileDependencies dependencies;
+            if (CompileRequest(request, response, dependencies))
+                StoreCachedResponse(cacheKey, response, dependencies);
+        }
+
+        WriteResponse(request.id, response);
+    }
+    catch (const std::exception& e)
+    {
+        std::string response = "\"success\":false,\"error\":";
+        AppendJsonString(response, e.what());
+        WriteResponse(request.id, response);
+    }
+}
+
+bool Server::CompileRequest(const Request& request, std::string& response, FileDependencies& dependencies)
+{
+    /*
+    Run all commands on a copy of the default state, and compile all files in the same way as the shell.
+    Commands that write additional files or change the state of the entire process are not supported.
+    */
+    static const std::vector<std::string> unsupportedCommands
+    {
+        "-PS", "--presetting", "--server", "--prelude", "--save-ast", "--load-ast", "--permutations", "-MD", "-MF",
+        "-j", "--jobs", "--color", "--help", "--version", "--pause", "--enum-extensions"
+    };
+
+    auto state = defaultState_;
+    CommandLine cmdLine(request.args);
+
+    bool success = true, cacheable = true;
+    std::string files;
+
+    while (!cmdLine.ReachedEnd())
+    {
+        auto cmdName = cmdLine.Accept();
+
+        Command::Identifier cmdIdent;
+        if (auto cmd = CommandFactory::Instance().Get(cmdName, &cmdIdent))
+        {
+            if (std::find(unsupportedCommands.begin(), unsupportedCommands.end(), cmdIdent.name) != unsupportedCommands.end())
+                throw std::invalid_argument("command '" + cmdIdent.name + "' is not supported in server mode");
+
+            /* Check if value is included within the command name */
+            if (cmdIdent.includesValue)
+            {
+                if (cmdName.size() > cmdIdent.name.size())
+                    cmdLine.Insert(cmdName.substr(cmdIdent.name.size()));
+                else
+                    throw std::invalid_argument("missing value in command '" + cmdIdent.name + "'");
+            }
+
+            cmd->Run(cmdLine, state);
+        }
+        else
+        {
+            /* Responses are only cached if no output file is written */
+            if (!state.outputFilename.empty() && !state.outputDesc.options.validateOnly)
+                cacheable = false;
+
+            if (!files.empty())
+                files += ',';
+
+            if (!CompileFile(state, cmdName, request, files, dependencies))
+                success = false;
+
+            /* Reset output filename and entry point */
+            state.outputFilename.clear();
+            state.inputDesc.entryPoint.clear();
+        }
+    }
+
+    response = std::string("\"success\":") + (success ? "true" : "false") + ",\"files\":[" + files + "]";
+
+    return cacheable;
+}
+
+bool Server::CompileFile(
+    ShellState& state, const std::string& filename, const Request& request, std::string& response, FileDependencies& dependencies)
+{
+    auto inputStream = std::make_shared<std::stringstream>();
+
+    /* Take source code either from request or from file cache */
+    if (request.hasSource)
+        *inputStream << request.source;
+    else
+    {
+        std::string content;
+        FileStamp stamp;
+
+        if (!ReadCachedFile(filename, content, stamp))
+            throw std::runtime_error("failed to read file: \"" + filename + "\"");
+
+        dependencies[filename] = stamp;
+        *inputStream << content;
+    }
+
+    std::stringstream outputStream;
+
+    state.inputDesc.filename        = filename;
+    state.inputDesc.sourceCode      = inputStream;
+    state.outputDesc.sourceCode     = &outputStream;
+
+    /* Read all include files from the file cache */
+    CachedIncludeHandler includeHandler(*this, dependencies);
+
+    includeHandler.searchPaths = state.searchPaths;
+    state.inputDesc.includeHandler = &includeHandler;
+
+    const auto inputPath = GetPathPart(filename);
+    if (!inputPath.empty())
+        includeHandler.searchPaths.push_back(inputPath);
+
+    /* Compile shader */
+    ServerLog                   log;
+    Reflection::ReflectionData  reflectionData;
+
+    auto result = CompileShader(
+        state.inputDesc,
+        state.outputDesc,
+        &log,
+        (state.showReflection ? &reflectionData : nullptr)
+    );
+
+    state.inputDesc.sourceCode      = nullptr;
+    state.inputDesc.includeHandler  = nullptr;
+    state.outputDesc.sourceCode     = nullptr;
+
+    /* Write output file only if an output filename has been specified */
+    std::string outputFilename;
+
+    if (result && !state.outputFilename.empty() && !state.outputDesc.options.validateOnly)
+    {
+        outputFilename = state.outputFilename;
+        Replace(outputFilename, "*", Shell::GetDefaultOutputFilename(state, filename));
+
+        std::ofstream outputFile(outputFilename);
+        if (outputFile.good())
+            outputFile << outputStream.str();
+        else
+            throw std::runtime_error("failed to write file: \"" + outputFilename + "\"");
+    }
+
+    /* Append JSON object for the result */
+    response += "{\"input\":";
+    AppendJsonString(response, filename);
+
+    if (!outputFilename.empty())
+    {
+        response += ",\"output\":";
+        AppendJsonString(response, outputFilename);
+    }
+
+    response += std::string(",\"success\":") + (result ? "true" : "false");
+
+    if (result && !state.outputDesc.options.validateOnly)
+    {
+        response += ",\"code\":";
+        AppendJsonString(response, outputStream.str());
+    }
+
+    response += ",\"reports\":[" + log.reports + "]";
+
+    if (state.showReflection)
+    {
+        std::stringstream reflectionStream;
+        PrintReflection(reflectionStream, reflectionData);
+        response += ",\"reflection\":";
+        AppendJsonString(response, reflectionStream.str());
+    }
+
+    response += '}';
+
+    return result;
+}
+
+void Server::WriteResponse(const std::string& id, const std::string& response)
+{
+    std::lock_guard<std::mutex> guard { outputMutex_ };
+    output_ << "{\"id\":" << id << ',' << response << '}' << std::endl;
+}
+
+/* ----- Caches ----- */
+
+bool Server::ReadCachedFile(const std::string& filename, std::string& content, FileStamp& stamp)
+{
+    if (!GetFileStamp(filename, stamp.modTime, stamp.size))
+        return false;
+
+    std::lock_guard<std::mutex> guard { fileCacheMutex_ };
+
+    /* Return cached file content, if the file has not been modified */
+    auto it = fileCache_.find(filename);
+    if (it != fileCache_.end() && it->second.stamp == stamp)
+    {
+        content = it->second.content;
+        return true;
+    }
+
+    /* Read file and store it in the cache */
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.good())
+        return false;
+
+    std::stringstream stream;
+    stream << file.rdbuf();
+
+    content = stream.str();
+    fileCache_[filename] = { stamp, content };
+
+    return true;
+}
+
+bool Server::FindCachedResponse(const std::string& key, std::string& response)
+{
+    std::lock_guard<std::mutex> guard { responseCacheMutex_ };
+
+    auto it = responseCache_.find(key);
+    if (it == responseCache_.end())
+        return false;
+
+    /* Validate all file dependencies of the cached response */
+    for (const auto& dependency : it->second.dependencies)
+    {
+        FileStamp stamp;
+        if (!GetFileStamp(dependency.first, stamp.modTime, stamp.size) || stamp != dependency.second)
+        {
+            responseCache_.erase(it);
+            return false;
+        }
+    }
+
+    response = it->second.response;
+
+    return true;
+}
+
+void Server::StoreCachedResponse(const std::string& key, const std::string& response, const FileDependencies& dependencies)
+{
+    std::lock_guard<std::mutex> guard { responseCacheMutex_ };
+    responseCache_[key] = { dependencies, response };
+}
+
+void Server::ClearCaches()
+{
+    {
+        std::lock_guard<std::mutex> guard { fileCacheMutex_ };
+        fileCache_.clear();
+    }
+    {
+        std::lock_guard<std::mutex> guard { responseCacheMutex_ };
+        responseCache_.clear();
+    }
+}
+
+
+} // /namespace Util
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,158 @@
+/*
+ * Server.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_SERVER_H
+#define XSC_SERVER_H
+
+
+#include "ShellState.h"
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace Xsc
+{
+
+namespace Util
+{
+
+
+/*
+Persistent compile server (see "--server" command).
+Each line of the input stream is a JSON object with a compile request, and each response is written as a single JSON line to the output stream:
+  request:  { "id": 1, "args": [ "-T", "frag", "-E", "main", "Example.hlsl" ], "source": "..." }
+  response: { "id": 1, "success": true, "files": [ { "input": "...", "output": "...", "success": true, "code": "...", "reports": [ ... ], "reflection": "..." } ] }
+The arguments are the same as for the command line. The optional "source" replaces the content of the input file (e.g. for unsaved editor buffers).
+Requests are processed concurrently, so the responses might be written in a different order than the requests.
+Included files and the responses of requests that do not write any output file are cached until the files are modified.
+*/
+class Server
+{
+
+    public:
+
+        Server(const ShellState& defaultState, std::istream& input, std::ostream& output);
+
+        // Processes all requests until the end of the input stream is reached or a "shutdown" request is received.
+        void Run();
+
+    private:
+
+        // Modification time (in nanoseconds) and size of a file to validate cached entries.
+        struct FileStamp
+        {
+            inline bool operator == (const FileStamp& rhs) const
+            {
+                return (modTime == rhs.modTime && size == rhs.size);
+            }
+
+            inline bool operator != (const FileStamp& rhs) const
+            {
+                return !(*this == rhs);
+            }
+
+            long long       modTime = 0;
+            long long       size    = 0;
+        };
+
+        struct CachedFile
+        {
+            FileStamp       stamp;
+            std::string     content;
+        };
+
+        // Files a response depends on with their stamps at the time of compilation.
+        using FileDependencies = std::map<std::string, FileStamp>;
+
+        struct CachedResponse
+        {
+            FileDependencies    dependencies;
+            std::string         response;
+        };
+
+        struct Request
+        {
+            std::string                 id          = "null";   // Raw JSON value of the request ID.
+            std::string                 command;                // Optional server command (e.g. "shutdown" or "clear-cache").
+            std::vector<std::string>    args;
+            bool                        hasArgs     = false;
+            bool                        hasSource   = false;
+            std::string                 source;
+        };
+
+        // Parses the specified JSON line into a request, or throws an exception on failure.
+        static void ParseRequest(const std::string& line, Request& request);
+
+        void WorkerThread();
+
+        void ProcessRequest(const std::string& line);
+
+        // Compiles all files of the specified request and returns the response (without ID). Returns true if the response can be cached.
+        bool CompileRequest(const Request& request, std::string& response, FileDependencies& dependencies);
+
+        // Compiles the specified file and appends the JSON object of the result to the specified response.
+        bool CompileFile(
+            ShellState&             state,
+            const std::string&      filename,
+            const Request&          request,
+            std::string&            response,
+            FileDependencies&       dependencies
+        );
+
+        void WriteResponse(const std::string& id, const std::string& response);
+
+        /* ----- Caches ----- */
+
+        // Reads the specified file from the file cache (or from disk if it is not cached or out of date). Returns false if the file can not be read.
+        bool ReadCachedFile(const std::string& filename, std::string& content, FileStamp& stamp);
+
+        bool FindCachedResponse(const std::string& key, std::string& response);
+        void StoreCachedResponse(const std::string& key, const std::string& response, const FileDependencies& dependencies);
+
+        void ClearCaches();
+
+        // Include handler that reads all files from the file cache and records them as dependencies.
+        class CachedIncludeHandler;
+
+        /* === Members === */
+
+        ShellState                              defaultState_;
+        std::istream&                           input_;
+        std::ostream&                           output_;
+
+        std::deque<std::string>                 requestQueue_;
+        bool                                    inputClosed_        = false;
+        std::mutex                              requestMutex_;
+        std::condition_variable                 requestCondition_;
+
+        std::mutex                              outputMutex_;
+
+        std::map<std::string, CachedFile>       fileCache_;
+        std::mutex                              fileCacheMutex_;
+
+        std::map<std::string, CachedResponse>   responseCache_;
+        std::mutex                              responseCacheMutex_;
+
+};
+
+
+} // /namespace Util
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -8,12 +8,19 @@
 #include "Shell.h"
 #include "Helper.h"
 #include "CommandFactory.h"
+#include "PermutationCompiler.h"
 #include <Xsc/ConsoleManip.h>
+#include <Xsc/Targets.h>
 #include <iostream>
 #include <sstream>
 #include <fstream>
 #include <algorithm>
 #include <cmath>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdlib>
 
 #ifdef _WIN32
 #include <conio.h>
@@ -114,6 +121,10 @@ bool Shell::ExecuteCommandLine(CommandLine& cmdLine, bool enableBriefHelp)
 
                 /* Reset output filename and entry point */
                 state_.outputFilename.clear();
+                state_.depFilename.clear();
+                state_.permutationsFilename.clear();
+                state_.saveASTFilename.clear();
+                state_.loadASTFilename.clear();
                 state_.inputDesc.entryPoint.clear();
                 state_.actionPerformed = true;
             }
@@ -164,6 +175,70 @@ void Shell::PopState()
     stateStack_.pop();
 }
 
+std::size_t Shell::ExecutePendingJobs()
+{
+    if (pendingJobs_.empty())
+        return 0;
+
+    auto jobs = std::move(pendingJobs_);
+    pendingJobs_.clear();
+
+    const auto numJobs      = jobs.size();
+    const auto numThreads   = std::min(static_cast<std::size_t>(std::max(state_.numThreads, 1u)), numJobs);
+
+    std::atomic<std::size_t>    nextJob { 0 };
+    std::vector<bool>           jobsDone(numJobs, false);
+    std::mutex                  jobsMutex;
+    std::condition_variable     jobsCondition;
+
+    /* Run jobs on worker threads, each thread takes the next job until all jobs are done */
+    auto WorkerThread = [&]()
+    {
+        for (std::size_t i = nextJob++; i < numJobs; i = nextJob++)
+        {
+            RunJob(*jobs[i]);
+            {
+                std::lock_guard<std::mutex> guard { jobsMutex };
+                jobsDone[i] = true;
+            }
+            jobsCondition.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+
+    for (std::size_t i = 0; i < numThreads; ++i)
+        threads.emplace_back(WorkerThread);
+
+    /* Print output of all jobs in the order they were added, as soon as each job is done */
+    std::size_t numFailed = 0;
+
+    for (std::size_t i = 0; i < numJobs; ++i)
+    {
+        {
+            std::unique_lock<std::mutex> lock { jobsMutex };
+            jobsCondition.wait(lock, [&]() { return jobsDone[i]; });
+        }
+
+        PrintJob(*jobs[i]);
+
+        if (!jobs[i]->result || !jobs[i]->errorMessage.empty())
+            ++numFailed;
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    return numFailed;
+}
+
+void Shell::PrintOutputSummary()
+{
+    if (numOutputFiles_ > 1)
+        output << numChangedOutputFiles_ << " of " << numOutputFiles_ << " output files changed" << std::endl;
+}
+
 
 /*
  * ======= Private: =======
@@ -198,122 +273,383 @@ static std::string TargetToExtension(const ShaderTarget shaderTarget)
     return "glsl";
 }
 
-std::string Shell::GetDefaultOutputFilename(const std::string& filename) const
+std::string Shell::GetDefaultOutputFilename(const ShellState& state, const std::string& filename)
 {
-    return (GetFilePart(filename) + "." + state_.inputDesc.entryPoint + "." + TargetToExtension(state_.inputDesc.shaderTarget));
+    return (GetFilePart(filename) + "." + state.inputDesc.entryPoint + "." + TargetToExtension(state.inputDesc.shaderTarget));
+}
+
+// Returns the specified code without the time point of the generator header (i.e. the line after "Generated by XShaderCompiler").
+static std::string StripGeneratorTimePoint(const std::string& s)
+{
+    const std::string marker = "Generated by XShaderCompiler\n";
+
+    const auto markerPos = s.find(marker);
+    if (markerPos != std::string::npos && markerPos < 256)
+    {
+        const auto start    = markerPos + marker.size();
+        const auto end      = s.find('\n', start);
+        if (end != std::string::npos)
+            return s.substr(0, start) + s.substr(end + 1);
+    }
+
+    return s;
+}
+
+bool Shell::WriteFileIfChanged(const std::string& filename, const std::string& content)
+{
+    /* Compare content with existing file */
+    std::ifstream existingFile(filename);
+    if (existingFile.good())
+    {
+        std::stringstream existingContent;
+        existingContent << existingFile.rdbuf();
+
+        if (StripGeneratorTimePoint(existingContent.str()) == StripGeneratorTimePoint(content))
+            return false;
+
+        existingFile.close();
+    }
+
+    /* Write new content to file */
+    std::ofstream file(filename);
+    if (!file.good())
+        throw std::runtime_error("failed to write file: \"" + filename + "\"");
+
+    file << content;
+
+    return true;
 }
 
 void Shell::Compile(const std::string& filename)
 {
     lastOutputFilename_.clear();
 
-    const auto  defaultOutputFilename   = GetDefaultOutputFilename(filename);
-    auto        outputFilename          = state_.outputFilename;
+    /* Create compile job with a snapshot of the current shell state */
+    auto job = MakeUnique<CompileJob>();
+
+    job->state      = state_;
+    job->filename   = filename;
+
+    if (!state_.preludeFilename.empty())
+        job->state.inputDesc.prelude = GetPrelude(state_);
+
+    const auto defaultOutputFilename = GetDefaultOutputFilename(state_, filename);
+    job->outputFilename = state_.outputFilename;
 
-    if (outputFilename.empty())
-        outputFilename = defaultOutputFilename;
+    if (job->outputFilename.empty())
+        job->outputFilename = defaultOutputFilename;
+    else
+        Replace(job->outputFilename, "*", defaultOutputFilename);
+
+    if (!state_.permutationsFilename.empty())
+    {
+        /* Compile all permutations of the shader file */
+        PermutationManifest manifest;
+        manifest.Load(state_.permutationsFilename);
+
+        PermutationCompiler compiler(output);
+        if (compiler.Compile(job->state, manifest, filename, job->outputFilename))
+            lastOutputFilename_ = job->outputFilename + ".permutations";
+
+        return;
+    }
+
+    if (state_.writeDepFile)
+        job->depFilename = (state_.depFilename.empty() ? job->outputFilename + ".d" : state_.depFilename);
+
+    if (state_.numThreads > 1)
+    {
+        /* Defer compilation to the parallel execution of all pending jobs */
+        job->headline = jobHeadline_;
+        jobHeadline_.clear();
+        pendingJobs_.emplace_back(std::move(job));
+    }
     else
-        Replace(outputFilename, "*", defaultOutputFilename);
+    {
+        /* Compile shader file and print output immediately */
+        RunJob(*job);
+        PrintJob(*job);
+
+        /* Store output filename after successful compilation */
+        if (job->result && job->errorMessage.empty() && !job->state.outputDesc.options.validateOnly)
+            lastOutputFilename_ = job->outputFilename;
+    }
+}
+
+void Shell::RunJob(CompileJob& job)
+{
+    auto& state = job.state;
 
     try
     {
-        /* Add pre-defined macros at the top of the input stream */
         auto inputStream = std::make_shared<std::stringstream>();
-        
-        for (const auto& macro : state_.predefinedMacros)
-        {
-            *inputStream << "#define " << macro.ident;
-            if (!macro.value.empty())
-                *inputStream << ' ' << macro.value;
-            *inputStream << std::endl;
-        }
 
         /* Open input stream */
-        state_.inputDesc.filename = filename;
+        state.inputDesc.filename = job.filename;
 
-        std::ifstream inputFile(filename);
+        std::ifstream inputFile(job.filename);
         if (!inputFile.good())
-            throw std::runtime_error("failed to read file: \"" + filename + "\"");
+            throw std::runtime_error("failed to read file: \"" + job.filename + "\"");
 
         *inputStream << inputFile.rdbuf();
 
+        job.inputRead = true;
+
         std::stringstream outputStream;
 
         /* Initialize input and output descriptors */
-        state_.inputDesc.sourceCode  = inputStream;
-        state_.outputDesc.sourceCode = &outputStream;
+        state.inputDesc.sourceCode  = inputStream;
+        state.outputDesc.sourceCode = &outputStream;
+
+        /* Read decorated AST from previous compilation, or write the new one into a buffer */
+        std::stringstream astOutputStream;
+
+        if (!state.loadASTFilename.empty())
+        {
+            std::ifstream astFile(state.loadASTFilename, std::ios::binary);
+            if (!astFile.good())
+                throw std::runtime_error("failed to read file: \"" + state.loadASTFilename + "\"");
+
+            auto astInputStream = std::make_shared<std::stringstream>();
+            *astInputStream << astFile.rdbuf();
+
+            state.inputDesc.analyzedAST = astInputStream;
+        }
+
+        if (!state.saveASTFilename.empty())
+            state.outputDesc.analyzedAST = &astOutputStream;
 
         /* Final setup before compilation */
-        StdLog                      log;
-        IncludeHandler              includeHandler;
-        Reflection::ReflectionData  reflectionData;
+        IncludeHandler includeHandler;
         
-        includeHandler.searchPaths = state_.searchPaths;
-        state_.inputDesc.includeHandler = &includeHandler;
+        includeHandler.searchPaths = state.searchPaths;
+        state.inputDesc.includeHandler = &includeHandler;
 
         /* Add file path to include paths */
-        const auto inputPath = GetPathPart(filename);
+        const auto inputPath = GetPathPart(job.filename);
         if (!inputPath.empty())
             includeHandler.searchPaths.push_back(inputPath);
 
+        /* Compile shader file (reflection is also required for the included files of the dependency file) */
+        job.result = CompileShader(
+            state.inputDesc,
+            state.outputDesc,
+            &job.log,
+            (state.showReflection || state.writeDepFile ? &job.reflectionData : nullptr)
+        );
+
+        /* Write result to output stream only on success */
+        if (job.result && !state.outputDesc.options.validateOnly)
+        {
+            job.outputChanged = WriteFileIfChanged(job.outputFilename, outputStream.str());
+            job.outputWritten = true;
+
+            if (state.writeDepFile)
+                WriteDepFile(job);
+        }
+
+        /* Write decorated AST even if the code generation failed */
+        if (!state.saveASTFilename.empty() && !astOutputStream.str().empty())
+        {
+            std::ofstream astFile(state.saveASTFilename, std::ios::binary);
+            if (!astFile.good())
+                throw std::runtime_error("failed to write file: \"" + state.saveASTFilename + "\"");
+
+            astFile << astOutputStream.rdbuf();
+        }
+    }
+    catch (const std::exception& err)
+    {
+        job.errorMessage = err.what();
+    }
+
+    /* Reset pointers to local objects */
+    state.inputDesc.sourceCode      = nullptr;
+    state.inputDesc.includeHandler  = nullptr;
+    state.inputDesc.analyzedAST     = nullptr;
+    state.outputDesc.sourceCode     = nullptr;
+    state.outputDesc.analyzedAST    = nullptr;
+}
+
+PreludePtr Shell::GetPrelude(const ShellState& state)
+{
+    /* Find prelude that has already been precompiled with the same configuration */
+    std::stringstream key;
+
+    key << state.preludeFilename << '\n' << static_cast<int>(state.inputDesc.shaderVersion) << '\n' << state.inputDesc.warnings << '\n';
+
+    for (const auto& macro : state.inputDesc.predefinedMacros)
+        key << "-D" << macro.ident << '=' << macro.value << '\n';
+
+    for (const auto& path : state.searchPaths)
+        key << "-I" << path << '\n';
+
+    auto it = preludes_.find(key.str());
+    if (it != preludes_.end())
+        return it->second;
+
+    /* Read prelude file */
+    auto inputStream = std::make_shared<std::stringstream>();
+
+    std::ifstream inputFile(state.preludeFilename);
+    if (!inputFile.good())
+        throw std::runtime_error("failed to read file: \"" + state.preludeFilename + "\"");
+
+    *inputStream << inputFile.rdbuf();
+
+    IncludeHandler includeHandler;
+
+    includeHandler.searchPaths = state.searchPaths;
+
+    const auto inputPath = GetPathPart(state.preludeFilename);
+    if (!inputPath.empty())
+        includeHandler.searchPaths.push_back(inputPath);
+
+    /* Pre-process prelude with the same input descriptor as the input files */
+    ShaderInput inputDesc = state.inputDesc;
+    {
+        inputDesc.filename          = state.preludeFilename;
+        inputDesc.sourceCode        = inputStream;
+        inputDesc.includeHandler    = &includeHandler;
+        inputDesc.prelude           = nullptr;
+    }
+
+    if (state.verbose)
+        output << "precompile prelude \"" << state.preludeFilename << '\"' << std::endl;
+
+    StdLog log;
+    auto prelude = PrecompilePrelude(inputDesc, &log);
+    log.PrintAll(state.verbose);
+
+    if (!prelude)
+        throw std::runtime_error("failed to precompile prelude: \"" + state.preludeFilename + "\"");
+
+    preludes_[key.str()] = prelude;
+
+    return prelude;
+}
+
+// Returns the specified path with escaped characters for a Makefile rule.
+static std::string EscapeMakePath(const std::string& s)
+{
+    std::string escaped;
+    escaped.reserve(s.size());
+
+    for (auto c : s)
+    {
+        if (c == ' ' || c == '#')
+            escaped += '\\';
+        else if (c == '$')
+            escaped += '$';
+        escaped += c;
+    }
+
+    return escaped;
+}
+
+void Shell::WriteDepFile(const CompileJob& job)
+{
+    std::stringstream depFile;
+
+    /* Write rule "OUTPUT: INPUT INCLUDES..." with one prerequisite per line */
+    depFile << EscapeMakePath(job.outputFilename) << ':';
+    depFile << " \\\n  " << EscapeMakePath(job.filename);
+
+    for (const auto& filename : job.reflectionData.includedFiles)
+        depFile << " \\\n  " << EscapeMakePath(filename);
+
+    depFile << std::endl;
+
+    WriteFileIfChanged(job.depFilename, depFile.str());
+}
+
+void Shell::PrintJob(CompileJob& job)
+{
+    const auto& state = job.state;
+
+    if (!job.headline.empty())
+        output << job.headline << std::endl;
+
+    if (job.inputRead)
+    {
         /* Show compilation/validation status */
-        if (state_.verbose)
+        if (state.verbose)
         {
-            if (state_.outputDesc.options.validateOnly)
-                output << "validate \"" << filename << '\"' << std::endl;
+            if (state.outputDesc.options.validateOnly)
+                output << "validate \"" << job.filename << '\"' << std::endl;
             else
-                output << "compile \"" << filename << "\" to \"" << outputFilename << '\"' << std::endl;
+                output << "compile \"" << job.filename << "\" to \"" << job.outputFilename << '\"' << std::endl;
         }
 
-        /* Compile shader file */
-        auto result = CompileShader(
-            state_.inputDesc,
-            state_.outputDesc,
-            &log,
-            (state_.showReflection ? &reflectionData : nullptr)
-        );
-
         /* Print all reports to the log output */
-        log.PrintAll(state_.verbose);
+        job.log.PrintAll(state.verbose);
 
-        if (result)
+        if (job.result)
         {
-            if (!state_.outputDesc.options.validateOnly)
+            if (state.verbose)
             {
-                if (state_.verbose)
-                    output << "compilation successful" << std::endl;
-
-                /* Write result to output stream only on success */
-                std::ofstream outputFile(outputFilename);
-                if (outputFile.good())
-                    outputFile << outputStream.rdbuf();
+                if (state.outputDesc.options.validateOnly)
+                    output << "validation successful" << std::endl;
                 else
-                    throw std::runtime_error("failed to write file: \"" + outputFilename + "\"");
+                    output << "compilation successful" << std::endl;
 
-                /* Store output filename after successful compilation */
-                lastOutputFilename_ = outputFilename;
+                if (job.outputWritten && !job.outputChanged)
+                    output << "output file unchanged: \"" << job.outputFilename << '\"' << std::endl;
             }
-            else if (state_.verbose)
-                output << "validation successful" << std::endl;
         }
         else
         {
             /* Always print message on failure */
-            if (state_.outputDesc.options.validateOnly)
+            if (state.outputDesc.options.validateOnly)
                 output << "validation failed" << std::endl;
             else
                 output << "compilation failed" << std::endl;
         }
+    }
 
-        /* Show output statistics (if enabled) */
-        if (state_.showReflection)
-            PrintReflection(output, reflectionData);
+    if (job.outputWritten)
+    {
+        ++numOutputFiles_;
+        if (job.outputChanged)
+            ++numChangedOutputFiles_;
     }
-    catch (const std::exception& err)
+
+    if (!job.errorMessage.empty())
     {
         /* Print error message */
-        output << err.what() << std::endl;
+        output << job.errorMessage << std::endl;
+    }
+    else if (state.showReflection)
+    {
+        /* Show output statistics (if enabled) */
+        PrintReflection(output, job.reflectionData);
     }
+
+    /* Validate output file after the output of the job (validation runs in the order of the jobs, even for parallel compilation) */
+    if (state.postValidation && job.outputWritten)
+        PostValidateJob(job);
+}
+
+void Shell::PostValidateJob(const CompileJob& job)
+{
+    /* Build command to run glslangValidator for the output file */
+    std::string cmd = "glslangValidator ";
+
+    if (IsLanguageVKSL(job.state.outputDesc.shaderVersion))
+        cmd += "-V ";
+
+    cmd += '\"';
+    cmd += job.outputFilename;
+    cmd += '\"';
+
+    /* Print command to standard output */
+    if (job.state.verbose)
+        output << cmd << std::endl;
+    else
+        output.flush();
+
+    /* Run command */
+    system(cmd.c_str());
 }
 
 
@@ -15,6 +15,9 @@
 #include "CommandLine.h"
 #include <ostream>
 #include <stack>
+#include <vector>
+#include <memory>
+#include <map>
 
 
 namespace Xsc
@@ -40,6 +43,27 @@ class Shell
 
         void WaitForUser();
 
+        /*
+        Compiles all pending jobs in parallel (see "-j" command) and prints their output in the order they were added.
+        Returns the number of jobs that have failed.
+        */
+        std::size_t ExecutePendingJobs();
+
+        // Prints how many output files have actually changed, if more than one output file has been written.
+        void PrintOutputSummary();
+
+        // Returns the number of compile jobs that are waiting for the parallel compilation.
+        inline std::size_t GetNumPendingJobs() const
+        {
+            return pendingJobs_.size();
+        }
+
+        // Sets the headline that is printed before the output of the next pending compile job (e.g. the presetting title).
+        inline void SetJobHeadline(const std::string& headline)
+        {
+            jobHeadline_ = headline;
+        }
+
         void PushState();
         void PopState();
 
@@ -49,6 +73,16 @@ class Shell
             return state_;
         }
 
+        // Returns the default output filename for the specified input filename, entry point, and shader target (e.g. "Example.main.vert").
+        static std::string GetDefaultOutputFilename(const ShellState& state, const std::string& filename);
+
+        /*
+        Writes the specified content to the file, unless the file already has the same content.
+        The time point of the generator header is ignored for this comparison, so unchanged output files keep their modification time (e.g. for incremental builds).
+        Returns true if the file has been written, or throws an exception on failure.
+        */
+        static bool WriteFileIfChanged(const std::string& filename, const std::string& content);
+
         // Returns the previously compiled output filename or an empty string, if the previous compilation has failed.
         inline const std::string& GetLastOutputFilename() const
         {
@@ -59,14 +93,57 @@ class Shell
 
     private:
 
-        std::string GetDefaultOutputFilename(const std::string& filename) const;
+        // Compile job with a snapshot of the shell state and all its output.
+        struct CompileJob
+        {
+            ShellState                  state;
+            std::string                 filename;
+            std::string                 outputFilename;
+            std::string                 depFilename;
+            std::string                 headline;
+            StdLog                      log;
+            Reflection::ReflectionData  reflectionData;
+            bool                        inputRead       = false;
+            bool                        result          = false;
+            bool                        outputWritten   = false;
+            bool                        outputChanged   = false;
+            std::string                 errorMessage;
+        };
+
+        using CompileJobPtr = std::unique_ptr<CompileJob>;
 
         void Compile(const std::string& filename);
 
-        ShellState              state_;
-        std::stack<ShellState>  stateStack_;
+        // Compiles the shader of the specified job, and writes the output file on success. This function is thread-safe.
+        void RunJob(CompileJob& job);
+
+        /*
+        Returns the precompiled prelude of the specified state (see "--prelude" command), or throws an exception on failure.
+        The prelude is only precompiled once for each combination of shader version, macros, and include paths.
+        */
+        PreludePtr GetPrelude(const ShellState& state);
+
+        // Writes the dependency file of the specified job with the output file as target and all input files as prerequisites.
+        void WriteDepFile(const CompileJob& job);
+
+        // Prints the reports and the reflection of the specified job to the output stream.
+        void PrintJob(CompileJob& job);
+
+        // Runs 'glslangValidator' for the output file of the specified job (see ShellState::postValidation).
+        void PostValidateJob(const CompileJob& job);
+
+        ShellState                  state_;
+        std::stack<ShellState>      stateStack_;
+
+        std::string                 lastOutputFilename_;
+
+        std::vector<CompileJobPtr>  pendingJobs_;
+        std::string                 jobHeadline_;
+
+        std::size_t                 numOutputFiles_         = 0;
+        std::size_t                 numChangedOutputFiles_  = 0;
 
-        std::string             lastOutputFilename_;
+        std::map<std::string, PreludePtr> preludes_;
 
         static Shell*           instance_;
 
@@ -19,12 +19,6 @@ namespace Util
 {
 
 
-struct PredefinedMacro
-{
-    std::string ident;
-    std::string value;
-};
-
 struct ShellState
 {
     // Shader input descriptor.
@@ -36,8 +30,20 @@ struct ShellState
     // Output filename (hint).
     std::string                     outputFilename;
 
-    // Predefined macros for the preprocessor
-    std::vector<PredefinedMacro>    predefinedMacros;
+    // Dependency filename (hint), or empty to append ".d" to the output filename.
+    std::string                     depFilename;
+
+    // Permutation manifest for the next input file, or empty to compile only a single permutation (see "--permutations" command).
+    std::string                     permutationsFilename;
+
+    // Prelude file that is precompiled once for all input files, or empty to compile without prelude (see "--prelude" command).
+    std::string                     preludeFilename;
+
+    // File to write the decorated AST of the next input file to, or empty to not write the AST (see "--save-ast" command).
+    std::string                     saveASTFilename;
+
+    // File to read the decorated AST of the next input file from, or empty to compile the input file (see "--load-ast" command).
+    std::string                     loadASTFilename;
 
     // Include search paths for the preprocessor.
     std::vector<std::string>        searchPaths;
@@ -51,6 +57,15 @@ struct ShellState
     // Show code reflection output after compilation.
     bool                            showReflection      = false;
 
+    // Write a Make/Ninja dependency file for each output file.
+    bool                            writeDepFile        = false;
+
+    // Validate each output file with 'glslangValidator' (only enabled for presettings with XSC_ENABLE_POST_VALIDATION).
+    bool                            postValidation      = false;
+
+    // Number of shader files that are compiled in parallel (see "-j" command).
+    unsigned int                    numThreads          = 1;
+
     // True, if any meaningful action has been performed (e.g. printed version or compiled any files).
     bool                            actionPerformed     = false;
 };
@@ -49,12 +49,18 @@ struct CompilerContext
     Xsc::Reflection::ReflectionData reflection;
 
     std::vector<const char*>        macros;
+    std::vector<const char*>        includedFiles;
+    std::vector<const char*>        relevantMacros;
     std::vector<XscBindingSlot>     textures;
     std::vector<XscBindingSlot>     storageBuffers;
     std::vector<XscBindingSlot>     constantBuffers;
     std::vector<XscBindingSlot>     inputAttributes;
     std::vector<XscBindingSlot>     outputAttributes;
     std::vector<XscSamplerState>    samplerStates;
+    std::vector<XscBindingSlot>     specConstants;
+    std::vector<XscBufferLayout>    bufferLayouts;
+    std::vector<XscBufferField>     bufferFields;
+    std::vector<XscBufferField>     pushConstantFields;
 };
 
 static struct CompilerContext g_compilerContext;
@@ -90,6 +96,10 @@ static void InitializeOptions(struct XscOptions* s)
     s->rowMajorAlignment        = false;
     s->separateShaders          = false;
     s->obfuscate                = false;
+    s->packUniforms             = false;
+    s->precisionInference       = XscEPrecisionDisabled;
+    s->pushConstantLimit        = 128;
+    s->pipelinedFrontend        = false;
     s->showAST                  = false;
     s->showTimes                = false;
 }
@@ -122,6 +132,9 @@ static void InitializeShaderInput(struct XscShaderInput* s)
     s->warnings             = 0;
 
     InitializeIncludeHandler(&(s->includeHandler));
+
+    s->predefinedMacros         = NULL;
+    s->predefinedMacrosCount    = 0;
 }
 
 static void InitializeShaderOutput(struct XscShaderOutput* s)
@@ -147,7 +160,7 @@ XSC_EXPORT void XscInitialize(struct XscShaderInput* inputDesc, struct XscShader
 
 static bool ValidateShaderInput(const struct XscShaderInput* s)
 {
-    return (s != NULL && s->sourceCode != NULL && s->entryPoint != NULL);
+    return (s != NULL && s->sourceCode != NULL && s->entryPoint != NULL && (s->predefinedMacrosCount == 0 || s->predefinedMacros != NULL));
 }
 
 static bool ValidateShaderOutput(const struct XscShaderOutput* s)
@@ -161,6 +174,14 @@ static void CopyReflection(const Xsc::Reflection::ReflectionData& src, struct Xs
     for (const auto& s : src.macros)
         g_compilerContext.macros.push_back(s.c_str());
 
+    g_compilerContext.includedFiles.clear();
+    for (const auto& s : src.includedFiles)
+        g_compilerContext.includedFiles.push_back(s.c_str());
+
+    g_compilerContext.relevantMacros.clear();
+    for (const auto& s : src.relevantMacros)
+        g_compilerContext.relevantMacros.push_back(s.c_str());
+
     for (const auto& s : src.textures)
         g_compilerContext.textures.push_back({ s.ident.c_str(), s.location });
 
@@ -200,10 +221,39 @@ static void CopyReflection(const Xsc::Reflection::ReflectionData& src, struct Xs
         );
     }
 
+    for (const auto& s : src.specConstants)
+        g_compilerContext.specConstants.push_back({ s.ident.c_str(), s.location });
+
+    g_compilerContext.bufferLayouts.clear();
+    g_compilerContext.bufferFields.clear();
+    g_compilerContext.pushConstantFields.clear();
+
+    for (const auto& s : src.bufferLayouts)
+    {
+        for (const auto& f : s.fields)
+            g_compilerContext.bufferFields.push_back({ f.ident.c_str(), f.type.c_str(), f.offset, f.size, f.arrayStride, f.matrixStride });
+    }
+
+    for (std::size_t i = 0, fieldOffset = 0; i < src.bufferLayouts.size(); ++i)
+    {
+        const auto& s = src.bufferLayouts[i];
+        g_compilerContext.bufferLayouts.push_back({ s.ident.c_str(), s.size, g_compilerContext.bufferFields.data() + fieldOffset, s.fields.size() });
+        fieldOffset += s.fields.size();
+    }
+
+    for (const auto& f : src.pushConstants.fields)
+        g_compilerContext.pushConstantFields.push_back({ f.ident.c_str(), f.type.c_str(), f.offset, f.size, f.arrayStride, f.matrixStride });
+
     /* Set references to output buffers */
     dst->macros                 = g_compilerContext.macros.data();
     dst->macrosCount            = g_compilerContext.macros.size();
 
+    dst->includedFiles          = g_compilerContext.includedFiles.data();
+    dst->includedFilesCount     = g_compilerContext.includedFiles.size();
+
+    dst->relevantMacros         = g_compilerContext.relevantMacros.data();
+    dst->relevantMacrosCount    = g_compilerContext.relevantMacros.size();
+
     dst->textures               = g_compilerContext.textures.data();
     dst->texturesCount          = g_compilerContext.textures.size();
 
@@ -212,6 +262,9 @@ static void CopyReflection(const Xsc::Reflection::ReflectionData& src, struct Xs
             
     dst->constantBuffers        = g_compilerContext.constantBuffers.data();
     dst->constantBufferCounts   = g_compilerContext.constantBuffers.size();
+
+    dst->bufferLayouts          = g_compilerContext.bufferLayouts.data();
+    dst->bufferLayoutsCount     = g_compilerContext.bufferLayouts.size();
             
     dst->inputAttributes        = g_compilerContext.inputAttributes.data();
     dst->inputAttributesCount   = g_compilerContext.inputAttributes.size();
@@ -222,6 +275,14 @@ static void CopyReflection(const Xsc::Reflection::ReflectionData& src, struct Xs
     dst->samplerStates          = g_compilerContext.samplerStates.data();
     dst->samplerStatesCount     = g_compilerContext.samplerStates.size();
 
+    dst->specConstants          = g_compilerContext.specConstants.data();
+    dst->specConstantsCount     = g_compilerContext.specConstants.size();
+
+    dst->pushConstants.ident        = (src.pushConstants.ident.empty() ? NULL : src.pushConstants.ident.c_str());
+    dst->pushConstants.size         = src.pushConstants.size;
+    dst->pushConstants.fields       = g_compilerContext.pushConstantFields.data();
+    dst->pushConstants.fieldsCount  = g_compilerContext.pushConstantFields.size();
+
     /* Copy remaining data fields */
     dst->numThreads.x = src.numThreads.x;
     dst->numThreads.y = src.numThreads.y;
@@ -351,6 +412,13 @@ XSC_EXPORT bool XscCompileShader(
     in.warnings             = inputDesc->warnings;
     in.includeHandler       = (&includeHandler);
 
+    in.predefinedMacros.resize(inputDesc->predefinedMacrosCount);
+    for (size_t i = 0; i < inputDesc->predefinedMacrosCount; ++i)
+    {
+        in.predefinedMacros[i].ident = ReadStringC(inputDesc->predefinedMacros[i].ident);
+        in.predefinedMacros[i].value = ReadStringC(inputDesc->predefinedMacros[i].value);
+    }
+
     /* Copy output descriptor */
     Xsc::ShaderOutput out;
 
@@ -381,6 +449,10 @@ XSC_EXPORT bool XscCompileShader(
     out.options.rowMajorAlignment       = outputDesc->options.rowMajorAlignment;
     out.options.separateShaders         = outputDesc->options.separateShaders;
     out.options.obfuscate               = outputDesc->options.obfuscate;
+    out.options.packUniforms            = outputDesc->options.packUniforms;
+    out.options.precisionInference      = static_cast<Xsc::PrecisionInference>(outputDesc->options.precisionInference);
+    out.options.pushConstantLimit       = outputDesc->options.pushConstantLimit;
+    out.options.pipelinedFrontend       = outputDesc->options.pipelinedFrontend;
     out.options.showAST                 = outputDesc->options.showAST;
     out.options.showTimes               = outputDesc->options.showTimes;
 
@@ -282,6 +282,12 @@ public ref class XscCompiler
                 //! All defined macros after pre-processing.
                 property Collections::Generic::List<String^>^                       Macros;
 
+                //! Resolved paths of all included files in the order of their first inclusion.
+                property Collections::Generic::List<String^>^                       IncludedFiles;
+
+                //! Sorted identifiers of all macros that influence the output code.
+                property Collections::Generic::List<String^>^                       RelevantMacros;
+
                 //! Texture bindings.
                 property Collections::Generic::List<BindingSlot^>^                  Textures;
 
@@ -497,6 +503,35 @@ public ref class XscCompiler
 
         };
 
+        /**
+        \brief Pre-defined macro structure.
+        \remarks This is equivalent to the directive "#define IDENT VALUE" at the beginning of the input source code.
+        */
+        ref class PredefinedMacro
+        {
+
+            public:
+
+                PredefinedMacro()
+                {
+                    Ident = nullptr;
+                    Value = nullptr;
+                }
+
+                PredefinedMacro(String^ ident, String^ value)
+                {
+                    Ident = ident;
+                    Value = value;
+                }
+
+                //! Macro identifier with an optional parameter list (e.g. "FOO" or "MUL(a,b)").
+                property String^    Ident;
+
+                //! Macro value. If this is null or empty, the macro is defined without a value.
+                property String^    Value;
+
+        };
+
         //! Shader input descriptor structure.
         ref class ShaderInput
         {
@@ -513,6 +548,7 @@ public ref class XscCompiler
                     SecondaryEntryPoint = nullptr;
                     WarningFlags        = Warnings::Disabled;
                     IncludeHandler      = nullptr;
+                    PredefinedMacros    = gcnew Collections::Generic::List<PredefinedMacro^>();
                 }
 
                 //! Specifies the filename of the input shader code. This is an optional attribute, and only a hint to the compiler.
@@ -551,6 +587,13 @@ public ref class XscCompiler
                 */
                 property SourceIncludeHandler^          IncludeHandler;
 
+                /**
+                \brief List of pre-defined macros. By default empty.
+                \remarks These macros are registered directly in the pre-processor before the input source code is processed,
+                so the source code is not modified and all line numbers are preserved.
+                */
+                property Collections::Generic::List<PredefinedMacro^>^ PredefinedMacros;
+
         };
 
         //! Vertex shader semantic (or rather attribute) layout structure.
@@ -991,6 +1034,16 @@ bool XscCompiler::CompileShader(ShaderInput^ inputDesc, ShaderOutput^ outputDesc
     in.warnings             = static_cast<unsigned int>(inputDesc->WarningFlags);
     in.includeHandler       = (&includeHandler);
 
+    if (inputDesc->PredefinedMacros != nullptr)
+    {
+        in.predefinedMacros.resize(inputDesc->PredefinedMacros->Count);
+        for (int i = 0; i < inputDesc->PredefinedMacros->Count; ++i)
+        {
+            in.predefinedMacros[i].ident = ToStdString(inputDesc->PredefinedMacros[i]->Ident);
+            in.predefinedMacros[i].value = ToStdString(inputDesc->PredefinedMacros[i]->Value);
+        }
+    }
+
     /* Copy output descriptor */
     Xsc::ShaderOutput out;
 
@@ -1082,6 +1135,16 @@ bool XscCompiler::CompileShader(ShaderInput^ inputDesc, ShaderOutput^ outputDesc
             for (const auto& s : src.macros)
                 dst->Macros->Add(gcnew String(s.c_str()));
 
+            /* Copy included files reflection */
+            dst->IncludedFiles = gcnew Collections::Generic::List<String^>();
+            for (const auto& s : src.includedFiles)
+                dst->IncludedFiles->Add(gcnew String(s.c_str()));
+
+            /* Copy relevant macros reflection */
+            dst->RelevantMacros = gcnew Collections::Generic::List<String^>();
+            for (const auto& s : src.relevantMacros)
+                dst->RelevantMacros->Add(gcnew String(s.c_str()));
+
             /* Copy binding slots reflection */
             dst->Textures           = ToManagedList(src.textures);
             dst->StorageBuffers     = ToManagedList(src.storageBuffers);
@@ -0,0 +1,37 @@
+
+// Buffer Layout Test 1
+// 19/10/2026
+
+struct Light
+{
+	float3 pos;
+	float range;
+	float4 color;
+};
+
+cbuffer Scene : register(b0)
+{
+	float4x4 viewProj;
+	row_major float3x4 world;
+	float3 eye;
+	float fogStart, fogEnd : packoffset(c9.y);
+	float2 uv[3];
+	Light lights[2];
+};
+
+cbuffer Packed : register(b1)
+{
+	float a : packoffset(c0.y);
+	float4 b : packoffset(c2);
+};
+
+StructuredBuffer<Light> lightBuf : register(t0);
+RWStructuredBuffer<float3> positions : register(u1);
+
+float4 main(float4 p : POSITION) : SV_Position
+{
+	float4 v = mul(viewProj, p) + mul(world, p).xyzz;
+	v += float4(eye, fogStart + fogEnd) + uv[2].xyxy + lights[1].color;
+	v += lightBuf[0].color + float4(positions[0], 1) + a + b;
+	return v;
+}
@@ -0,0 +1,16 @@
+// Buffer Layout Test 2
+// 19/10/2026
+
+// ESSL has no explicit member offsets, so 'packoffset' must not be written to the output
+
+cbuffer Material : register(b0)
+{
+	float4 diffuse;
+	float roughness, metallic : packoffset(c2.z);
+	float4 emissive : packoffset(c4);
+};
+
+float4 main() : SV_Target
+{
+	return diffuse * roughness + emissive * metallic;
+}
@@ -0,0 +1,16 @@
+// Buffer Layout Test 3
+// 19/10/2026
+
+// GLSL requires increasing member offsets, so 'b' (packoffset before 'c') must be reported as error
+
+cbuffer Settings : register(b0)
+{
+	float4 a : packoffset(c0);
+	float4 c : packoffset(c2);
+	float4 b : packoffset(c1);
+};
+
+float4 main() : SV_Target
+{
+	return a + b + c;
+}
@@ -0,0 +1,18 @@
+
+// Intrinsic Test 2
+// 19/10/2026
+
+// Integral arguments of floating-point intrinsics must be converted to float
+float4 PS(int4 i : COLOR, uint n : TEXCOORD) : SV_Target
+{
+    float s = sin(n);
+    float4 v = normalize(i);
+    float d = dot(i.xyz, float2(1, 2));
+    float l = length(int2(3, 4));
+    float3 c = cross(i.xyz, float3(0, 1, 0));
+    
+    float x, y;
+    sincos(n, x, y);
+    
+    return float4(s + d + l + x + y, c) + v + pow(i, 2);
+}
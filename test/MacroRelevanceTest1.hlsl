@@ -0,0 +1,37 @@
+// Macro Relevance Test 1
+// 19/10/2026
+
+// 'SCALE' (global constant), 'COUNT' and 'GAIN' (structure member and member function),
+// and 'BIAS' (after '#line'-directive) must be listed as relevant macros, 'UNUSED' must not
+
+#define SCALE 2.0
+#define BIAS 0.5
+#define UNUSED 1.0
+#define COUNT 3
+#define GAIN 4.0
+
+static const float k = SCALE;
+
+struct Weights
+{
+	float w[COUNT];
+
+	float Apply(float v)
+	{
+		return v * w[0] * GAIN;
+	}
+};
+
+float Unused()
+{
+	return UNUSED;
+}
+
+#line 200
+
+float4 main() : SV_Target
+{
+	Weights weights;
+	weights.w[0] = BIAS;
+	return (float4)weights.Apply(k);
+}
@@ -0,0 +1,24 @@
+
+// Permutation Test 1
+// 19/10/2026
+
+cbuffer Settings : register(b0)
+{
+	float4 color;
+	float fogDensity;
+};
+
+float4 main(float4 pos : SV_Position, float2 tc : TEXCOORD0) : SV_Target
+{
+	float4 c = color;
+	
+	#if USE_FOG
+	c.rgb *= exp(-fogDensity * pos.z);
+	#endif
+	
+	#ifdef USE_VIGNETTE
+	c.rgb *= 1.0 - length(tc - 0.5);
+	#endif
+	
+	return c;
+}
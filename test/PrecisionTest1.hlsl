@@ -0,0 +1,40 @@
+// Precision Test 1
+// 19/10/2026
+
+// Vertex positions and texture coordinates are 'highp', half values are 'mediump' (also 'min10float', since there is no 'lowp' inference).
+// With conservative inference, 'half' values that are passed as texture coordinates ('TEXCOORD' semantic) are 'highp'.
+
+Texture2D tex : register(t0);
+SamplerState smpl : register(s0);
+
+struct VOut
+{
+	float4 pos : SV_Position;
+	float2 texCoord : TEXCOORD0;
+	half2 detailCoord : TEXCOORD1;
+	half4 color : COLOR;
+};
+
+VOut VS(float3 pos : POSITION, half2 texCoord : TEXCOORD0, min10float4 color : COLOR)
+{
+	VOut o;
+	o.pos = float4(pos, 1);
+	o.texCoord = texCoord;
+	half2 detail = texCoord * 4.0;
+	o.detailCoord = detail;
+	o.color = color;
+	return o;
+}
+
+half Luminance(half3 c)
+{
+	return dot(c, half3(0.299, 0.587, 0.114));
+}
+
+float4 PS(VOut i) : SV_Target
+{
+	float4 diffuse = tex.Sample(smpl, i.texCoord) * tex.Sample(smpl, i.detailCoord);
+	float lum = Luminance(i.color.rgb);
+	min10float alpha = i.color.a;
+	return float4(diffuse.rgb * lum, alpha);
+}
@@ -0,0 +1,18 @@
+
+// Prelude Test 1
+// 19/10/2026
+
+#include "TestHeader1.h"
+
+#define GAMMA 2.2
+
+struct Light
+{
+	float3 dir;
+	float4 color;
+};
+
+float3 ToLinear(float3 c)
+{
+	return pow(c, GAMMA);
+}
@@ -0,0 +1,17 @@
+
+// Prelude Test 1
+// 19/10/2026
+
+// Must be ignored, since it has already been included by the prelude
+#include "TestHeader1.h"
+
+cbuffer Scene : register(b0)
+{
+	Light light;
+};
+
+float4 main(float3 normal : NORMAL, float3 albedo : COLOR) : SV_Target
+{
+	float NdotL = saturate(dot(normal, -light.dir)) * M_PI;
+	return float4(ToLinear(albedo) * light.color.rgb * NdotL, 1);
+}
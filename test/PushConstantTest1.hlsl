@@ -0,0 +1,36 @@
+
+// Push Constant Test 1
+// 19/10/2026
+
+[vk::push_constant]
+cbuffer PerDraw : register(b0)
+{
+	float4x4	wvpMatrix;
+	float3		tint;
+	float		alpha;
+};
+
+[vk::push_constant]
+cbuffer PerMaterial : register(b1)
+{
+	float4		colors[16];
+};
+
+cbuffer Settings : register(b2)
+{
+	float4		lightDir;
+};
+
+struct VOut
+{
+	float4 position : SV_Position;
+	float4 color : COLOR;
+};
+
+VOut main(float4 pos : POSITION)
+{
+	VOut outp;
+	outp.position = mul(wvpMatrix, pos);
+	outp.color = float4(tint, alpha) * colors[0] * lightDir.w;
+	return outp;
+}
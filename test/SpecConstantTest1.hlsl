@@ -0,0 +1,21 @@
+
+// Specialization Constant Test 1
+// 19/10/2026
+
+[vk::constant_id(0)] static const int numLights = 4;
+[vk::constant_id(1)] static const float fogDensity = 0.5;
+[vk::constant_id(2)] bool enableFog;
+
+float4 main(float4 color : COLOR) : SV_Target
+{
+	float4 c = color;
+
+	for (int i = 0; i < numLights; ++i)
+		c *= 0.9;
+
+	if (enableFog)
+		c *= fogDensity;
+
+	return c;
+}
+
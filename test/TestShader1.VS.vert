@@ -0,0 +1,64 @@
+// GLSL Vertex Shader "VS"
+// Generated by XShaderCompiler
+// 19/10/2026 04:21:34
+
+#version 430
+
+in vec3 coord;
+in vec3 normal;
+in vec2 texCoord;
+in vec4 color;
+in vec4 jointWeights;
+
+     out vec2 xsv_TEXCOORD0;
+flat out vec4 xsv_COLOR0;
+
+struct ParamStruct
+{
+    int param;
+};
+
+layout(std140) uniform VertexParam
+{
+             layout(row_major) mat4        wvpMatrix;
+    flat              vec3        xst_normal[3][2], test3;
+    centroid const    ParamStruct param0;
+                      struct dataStruct
+    {
+        vec2  v0, v1;
+        ivec2 v2;
+    }
+    
+    data[10];
+    ParamStruct param1;
+};
+
+struct TestStruct
+{
+    mat4 mat;
+    vec4 v4;
+};
+
+vec3 GammaCorrect(vec3 xst_color, float gamma)
+{
+    return pow(xst_color, vec3(1.0 / gamma));
+}
+
+void main()
+{
+    TestStruct test = TestStruct(mat4(0), vec4(0));
+    gl_Position = ((vec4(coord, 1.0) + vec4(0)) * wvpMatrix);
+    xsv_TEXCOORD0 = texCoord + vec2(jointWeights);
+    gl_ClipDistance[0] = 0.0;
+    gl_ClipDistance[1] = 1.0;
+    vec3 lightDir = vec3(0.5);
+    vec3 lightDir2 = vec3(0.5, -0.5, 1.0);
+    vec3 xst_normal = normalize(normal);
+    if (gl_VertexID < 3 && gl_VertexID < 3)
+    {
+        float NdotL = dot(xst_normal, -normalize(lightDir));
+        float shading = max(0.2, NdotL);
+    }
+    xsv_COLOR0 = vec4(GammaCorrect(color.xyz, 1.2), 1.0);
+}
+
@@ -0,0 +1,36 @@
+
+// Uniform Packing Test 1
+// 19/10/2026
+
+cbuffer Scene : register(b0)
+{
+	float4x4 viewProj;
+	row_major float3x4 world;
+	float3 eye;
+	float fogStart;
+	float2 uvScale, uvOffset;
+	float4 colors[3];
+	float weights[4];
+};
+
+cbuffer Material : register(b1)
+{
+	float3 diffuse;
+	int mode;
+};
+
+struct VOut
+{
+	float4 pos : SV_Position;
+	float4 color : COLOR;
+};
+
+VOut main(float4 p : POSITION, float2 tc : TEXCOORD)
+{
+	VOut o;
+	o.pos = mul(viewProj, p) + mul(world, p).xyzz;
+	o.color = colors[(int)tc.x + 1] * weights[1] + float4(eye * fogStart, uvScale.y);
+	o.color.xy += tc * uvScale + uvOffset;
+	o.color.rgb += (mode > 0 ? diffuse : eye);
+	return o;
+}